@@ -34,6 +34,7 @@ cdef extern from "isce/geometry/Geocode.h" namespace "isce::geometry":
         void thresholdGeo2rdr(double threshold)
         void numiterGeo2rdr(int numiter)
         void linesPerBlock(size_t lines)
+        void columnsPerBlock(size_t columns)
         void demBlockMargin(double margin)
         void radarBlockMargin(int margin)
         void interpolator(dataInterpMethod method)
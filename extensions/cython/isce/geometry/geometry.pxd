@@ -11,7 +11,7 @@ from Cartesian cimport cartesian_t
 from LUT2d cimport LUT2d
 from RadarGridParameters cimport RadarGridParameters
 
-cdef extern from "isce/geometry/geometry.h" namespace "isce::geometry":
+cdef extern from "isce/geometry/geometry.h" namespace "isce::geometry" nogil:
 
     # Map coordinates to radar geometry coordinates transformer
     int geo2rdr(const cartesian_t &,
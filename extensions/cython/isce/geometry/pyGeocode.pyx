@@ -27,6 +27,7 @@ cdef class pyGeocodeBase:
         interpMethod (Optional[str]):       Image interpolation method
                                                 ('sinc', 'bilinear', 'bicubic', 'nearest',
                                                  'biquintic')
+        columnsPerBlock (Optional[int]):    Number of columns per geocoded tile (0 for full width).
 
     Return:
         None
@@ -40,6 +41,7 @@ cdef class pyGeocodeBase:
     cdef double threshold
     cdef int numiter
     cdef int linesPerBlock
+    cdef int columnsPerBlock
     cdef double demBlockMargin
     cdef int radarBlockMargin
     cdef dataInterpMethod interpMethod
@@ -82,7 +84,8 @@ cdef class pyGeocodeBase:
                   int linesPerBlock=1000,
                   double demBlockMargin=0.1,
                   int radarBlockMargin=10,
-                  interpMethod='biquintic'):
+                  interpMethod='biquintic',
+                  int columnsPerBlock=0):
 
         # Save pointers to ISCE objects
         self.c_orbit = orbit.c_orbit
@@ -92,6 +95,7 @@ cdef class pyGeocodeBase:
         self.threshold = threshold
         self.numiter = numiter
         self.linesPerBlock = linesPerBlock
+        self.columnsPerBlock = columnsPerBlock
         self.demBlockMargin = demBlockMargin
         self.radarBlockMargin = radarBlockMargin
         self.interpMethod = self.demInterpMethods[interpMethod]
@@ -168,6 +172,7 @@ cdef class pyGeocodeFloat(pyGeocodeBase):
         c_geocode.thresholdGeo2rdr(self.threshold)
         c_geocode.numiterGeo2rdr(self.numiter)
         c_geocode.linesPerBlock(self.linesPerBlock)
+        c_geocode.columnsPerBlock(self.columnsPerBlock)
         c_geocode.demBlockMargin(self.demBlockMargin)
         c_geocode.radarBlockMargin(self.radarBlockMargin)
         c_geocode.interpolator(self.interpMethod)
@@ -210,6 +215,7 @@ cdef class pyGeocodeDouble(pyGeocodeBase):
         c_geocode.thresholdGeo2rdr(self.threshold)
         c_geocode.numiterGeo2rdr(self.numiter)
         c_geocode.linesPerBlock(self.linesPerBlock)
+        c_geocode.columnsPerBlock(self.columnsPerBlock)
         c_geocode.demBlockMargin(self.demBlockMargin)
         c_geocode.radarBlockMargin(self.radarBlockMargin)
         c_geocode.interpolator(self.interpMethod)
@@ -252,6 +258,7 @@ cdef class pyGeocodeComplexFloat(pyGeocodeBase):
         c_geocode.thresholdGeo2rdr(self.threshold)
         c_geocode.numiterGeo2rdr(self.numiter)
         c_geocode.linesPerBlock(self.linesPerBlock)
+        c_geocode.columnsPerBlock(self.columnsPerBlock)
         c_geocode.demBlockMargin(self.demBlockMargin)
         c_geocode.radarBlockMargin(self.radarBlockMargin)
         c_geocode.interpolator(self.interpMethod)
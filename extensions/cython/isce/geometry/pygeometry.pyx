@@ -4,7 +4,9 @@
 # Copyright 2017-2019
 #
 
+import numpy as np
 from cython.operator cimport dereference as deref
+from cython.parallel cimport prange
 from geometry cimport *
 from Orbit cimport orbitInterpMethod
 
@@ -71,6 +73,157 @@ def py_rdr2geo(pyOrbit orbit,  pyEllipsoid ellps,
 
     return llh
 
+cdef inline int _geo2rdr_point(const double * llh, const Ellipsoid & ellps,
+                               const Orbit & orbit, const LUT2d[double] & doppler,
+                               double * aztime, double * slantRange,
+                               double wvl, double threshold, int maxiter,
+                               double dR) nogil:
+    """
+    Thread-safe geo2rdr of a single point; target coordinates stay local to the call.
+    """
+    cdef cartesian_t cart_llh
+    cart_llh[0] = llh[0]
+    cart_llh[1] = llh[1]
+    cart_llh[2] = llh[2]
+    return geo2rdr(cart_llh, ellps, orbit, doppler, aztime[0], slantRange[0],
+                   wvl, threshold, maxiter, dR)
+
+
+cdef inline int _rdr2geo_point(double aztime, double slantRange, double doppler,
+                               const Orbit & orbit, const Ellipsoid & ellps,
+                               const DEMInterpolator & demInterpolator,
+                               double * llh, double wvl, int side,
+                               double threshold, int maxIter, int extraIter,
+                               orbitInterpMethod orbitMethod) nogil:
+    """
+    Thread-safe rdr2geo of a single point; target coordinates stay local to the call.
+    """
+    cdef cartesian_t targ_llh
+    targ_llh[0] = llh[0]
+    targ_llh[1] = llh[1]
+    targ_llh[2] = llh[2]
+    cdef int converged = rdr2geo(aztime, slantRange, doppler, orbit, ellps,
+                                 demInterpolator, targ_llh, wvl, side,
+                                 threshold, maxIter, extraIter, orbitMethod)
+    llh[0] = targ_llh[0]
+    llh[1] = targ_llh[1]
+    llh[2] = targ_llh[2]
+    return converged
+
+
+def py_geo2rdr_array(llh, pyEllipsoid ellps, pyOrbit orbit, pyLUT2d doppler,
+                     double wvl, double threshold = 0.05, int maxiter = 50,
+                     double dR = 1.0e-8):
+    """
+    Vectorized geo2rdr over many targets. The GIL is released and targets are
+    distributed over OpenMP threads.
+
+    Args:
+        llh (numpy.ndarray):            (N, 3) array of lon/lat (radians) and height.
+                                        C-contiguous float64 input is used without copying.
+        ellps (pyEllipsoid):            Ellipsoid.
+        orbit (pyOrbit):                Orbit.
+        doppler (pyLUT2d):              Doppler LUT.
+        wvl (float):                    Radar wavelength.
+        threshold (Optional[float]):    Azimuth time convergence threshold.
+        maxiter (Optional[int]):        Max number of Newton iterations.
+        dR (Optional[float]):           Slant range step for Doppler derivative.
+
+    Returns:
+        aztime (numpy.ndarray):         (N,) azimuth times.
+        slantRange (numpy.ndarray):     (N,) slant ranges.
+        converged (numpy.ndarray):      (N,) convergence flags.
+    """
+    cdef double[:, ::1] c_llh = np.ascontiguousarray(llh, dtype=np.float64).reshape(-1, 3)
+    cdef Py_ssize_t npts = c_llh.shape[0]
+
+    # Allocate outputs
+    aztime = np.zeros(npts, dtype=np.float64)
+    slantRange = np.zeros(npts, dtype=np.float64)
+    converged = np.zeros(npts, dtype=np.int32)
+    cdef double[::1] c_aztime = aztime
+    cdef double[::1] c_slantRange = slantRange
+    cdef int[::1] c_converged = converged
+
+    # Loop over targets without the GIL
+    cdef Py_ssize_t i
+    for i in prange(npts, nogil=True, schedule='dynamic', chunksize=64):
+        c_converged[i] = _geo2rdr_point(&c_llh[i, 0],
+                                        deref(ellps.c_ellipsoid),
+                                        deref(orbit.c_orbit),
+                                        deref(doppler.c_lut),
+                                        &c_aztime[i], &c_slantRange[i],
+                                        wvl, threshold, maxiter, dR)
+
+    return aztime, slantRange, converged
+
+
+def py_rdr2geo_array(pyOrbit orbit, pyEllipsoid ellps,
+                     aztime, slantRange, int side,
+                     double doppler         = 0.0,
+                     double wvl             = 0.24,
+                     double threshold       = 0.05,
+                     int maxIter            = 50,
+                     int extraIter          = 50,
+                     orbitMethod            = 'hermite',
+                     demInterpolatorHeight  = 0):
+    """
+    Vectorized rdr2geo over many (azimuth time, slant range) pairs. The GIL is
+    released and points are distributed over OpenMP threads.
+
+    Args:
+        orbit (pyOrbit):                    Orbit.
+        ellps (pyEllipsoid):                Ellipsoid.
+        aztime (numpy.ndarray):             (N,) azimuth times.
+        slantRange (numpy.ndarray):         (N,) slant ranges.
+                                            C-contiguous float64 inputs are used without copying.
+        side (int):                         Look side.
+        doppler (Optional[float]):          Doppler centroid.
+        wvl (Optional[float]):              Radar wavelength.
+        threshold (Optional[float]):        Slant range convergence threshold.
+        maxIter (Optional[int]):            Max number of primary iterations.
+        extraIter (Optional[int]):          Number of extra refinement iterations.
+        orbitMethod (Optional[str]):        Orbit interpolation method ('hermite', 'sch', 'legendre').
+        demInterpolatorHeight (Optional[float]): Constant reference height.
+
+    Returns:
+        llh (numpy.ndarray):                (N, 3) lon/lat (radians) and height.
+        converged (numpy.ndarray):          (N,) convergence flags.
+    """
+    # Orbit interpolation methods
+    orbitInterpMethods = {
+        'hermite':    orbitInterpMethod.HERMITE_METHOD,
+        'sch' :        orbitInterpMethod.SCH_METHOD,
+        'legendre': orbitInterpMethod.LEGENDRE_METHOD
+    }
+    cdef orbitInterpMethod orbitMethodCpp = orbitInterpMethods[orbitMethod]
+    cdef DEMInterpolator demInterpolator = DEMInterpolator(demInterpolatorHeight)
+
+    cdef double[::1] c_aztime = np.ascontiguousarray(aztime, dtype=np.float64).ravel()
+    cdef double[::1] c_slantRange = np.ascontiguousarray(slantRange, dtype=np.float64).ravel()
+    if c_aztime.shape[0] != c_slantRange.shape[0]:
+        raise ValueError('aztime and slantRange must have the same number of elements')
+    cdef Py_ssize_t npts = c_aztime.shape[0]
+
+    # Allocate outputs
+    llh = np.zeros((npts, 3), dtype=np.float64)
+    converged = np.zeros(npts, dtype=np.int32)
+    cdef double[:, ::1] c_llh = llh
+    cdef int[::1] c_converged = converged
+
+    # Loop over points without the GIL
+    cdef Py_ssize_t i
+    for i in prange(npts, nogil=True, schedule='dynamic', chunksize=64):
+        c_converged[i] = _rdr2geo_point(c_aztime[i], c_slantRange[i], doppler,
+                                        deref(orbit.c_orbit),
+                                        deref(ellps.c_ellipsoid),
+                                        demInterpolator,
+                                        &c_llh[i, 0], wvl, side,
+                                        threshold, maxIter, extraIter,
+                                        orbitMethodCpp)
+
+    return llh, converged
+
 def py_computeDEMBounds(pyOrbit orbit,
                         pyEllipsoid ellps,
                         pyLUT2d doppler,
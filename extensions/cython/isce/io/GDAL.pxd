@@ -4,18 +4,34 @@
 # Copyright 2017-2018
 #
 
+# Virtual memory mappings of raster bands
+cdef extern from "cpl_virtualmem.h":
+    ctypedef struct CPLVirtualMem:
+        pass
+    void * CPLVirtualMemGetAddr(CPLVirtualMem *)
+    void CPLVirtualMemFree(CPLVirtualMem *)
+
 # Get some data types from GDAL
 cdef extern from "gdal.h":
 
     # Get error codes
     ctypedef int CPLErr
 
+    # 64-bit integer for line spacing
+    ctypedef long long GIntBig
+
+    # Get read/write flags
+    ctypedef enum GDALRWFlag:
+        GF_Read = 0
+        GF_Write = 1
+
     # GDAL RasterBand class
     cdef cppclass GDALRasterBand:
         int GetXSize()
         int GetYSize()
         int GetBand()
         double GetNoDataValue()
+        CPLVirtualMem * GetVirtualMemAuto(GDALRWFlag, int *, GIntBig *, char **)
 
     # GDAL Dataset class
     cdef cppclass GDALDataset:
@@ -44,6 +60,9 @@ cdef extern from "gdal.h":
         GDT_CFloat64 = 11
         GDT_TypeCount = 12
 
+    # Size of a datatype in bits
+    int GDALGetDataTypeSize(GDALDataType)
+
     # Function to open a dataset
     cdef cppclass GDALDatasetH
     GDALDatasetH GDALOpen(const char *, GDALAccess)
@@ -42,6 +42,9 @@ cdef extern from "isce/io/Raster.h" namespace "isce::io":
         int getEPSG()
         GDALDataset* dataset()
 
+        # Block I/O
+        void getSetBlock[T](T *, size_t, size_t, size_t, size_t, size_t, GDALRWFlag) nogil except +raisePyError
+
         # Setters
         void addRasterToVRT(const Raster &) except +raisePyError
         void setEPSG(int)
@@ -10,10 +10,38 @@ from libcpp cimport bool
 from libcpp.string cimport string
 from libcpp.vector cimport vector
 from libc.stdint cimport uint64_t
+from cpython.buffer cimport PyBUF_WRITABLE, PyBUF_FORMAT
 from Raster cimport Raster
 from GDAL cimport GDALDataset, GDALAccess, GDALRegister_IH5
+from GDAL cimport GDALRasterBand, GDALRWFlag, GIntBig, GDALGetDataTypeSize
+from GDAL cimport CPLVirtualMem, CPLVirtualMemGetAddr, CPLVirtualMemFree
 from GDAL cimport GDALDataType as GDT
 
+# Buffer element types that map to a GDALDataType
+ctypedef fused rasterio_t:
+    unsigned char
+    short
+    unsigned short
+    int
+    unsigned int
+    float
+    double
+    float complex
+    double complex
+
+# Buffer protocol format strings for each GDALDataType
+_gdalBufferFormats = {
+    GDT.GDT_Byte: b'B',
+    GDT.GDT_UInt16: b'H',
+    GDT.GDT_Int16: b'h',
+    GDT.GDT_UInt32: b'I',
+    GDT.GDT_Int32: b'i',
+    GDT.GDT_Float32: b'f',
+    GDT.GDT_Float64: b'd',
+    GDT.GDT_CFloat32: b'Zf',
+    GDT.GDT_CFloat64: b'Zd',
+}
+
 cdef class pyRaster:
     '''
     Python wrapper for isce::core::Raster
@@ -233,4 +261,163 @@ cdef class pyRaster:
 
         self.c_raster.addRasterToVRT(raster.c_raster[0])
 
+    def _checkBlock(self, Py_ssize_t length, Py_ssize_t width,
+                    size_t xoff, size_t yoff, size_t band):
+        '''
+        Validate a block request against raster dimensions.
+        '''
+        if band < 1 or band > self.c_raster.numBands():
+            raise ValueError('Band {0} out of range [1, {1}]'.format(
+                band, self.c_raster.numBands()))
+        if (xoff + width > self.c_raster.width()) or (yoff + length > self.c_raster.length()):
+            raise ValueError('Block of size {0}x{1} at ({2}, {3}) exceeds raster '
+                             'dimensions {4}x{5}'.format(length, width, yoff, xoff,
+                             self.c_raster.length(), self.c_raster.width()))
+
+    def getBlock(self, rasterio_t[:, ::1] data, size_t xoff=0, size_t yoff=0,
+                 size_t band=1):
+        '''
+        Read a block of the raster into a caller-provided numpy array. The block
+        size is given by the shape of the array. Data is read directly into the
+        array's memory with the GIL released.
+
+        Args:
+            data (numpy.ndarray): C-contiguous 2D array to read into
+            xoff (Optional[int]): Pixel offset of the block (0-based)
+            yoff (Optional[int]): Line offset of the block (0-based)
+            band (Optional[int]): Band index (1-based)
+
+        Returns:
+            None
+        '''
+        cdef size_t length = data.shape[0]
+        cdef size_t width = data.shape[1]
+        self._checkBlock(length, width, xoff, yoff, band)
+        if length == 0 or width == 0:
+            return
+
+        with nogil:
+            self.c_raster.getSetBlock[rasterio_t](&data[0, 0], xoff, yoff, width, length,
+                                      band, GDALRWFlag.GF_Read)
+
+    def setBlock(self, const rasterio_t[:, ::1] data, size_t xoff=0, size_t yoff=0,
+                 size_t band=1):
+        '''
+        Write a block of the raster from a caller-provided numpy array. The block
+        size is given by the shape of the array. Data is written directly from the
+        array's memory with the GIL released.
+
+        Args:
+            data (numpy.ndarray): C-contiguous 2D array to write from
+            xoff (Optional[int]): Pixel offset of the block (0-based)
+            yoff (Optional[int]): Line offset of the block (0-based)
+            band (Optional[int]): Band index (1-based)
+
+        Returns:
+            None
+        '''
+        cdef size_t length = data.shape[0]
+        cdef size_t width = data.shape[1]
+        if self.isReadOnly:
+            raise IOError('Cannot write to a read-only raster')
+        self._checkBlock(length, width, xoff, yoff, band)
+        if length == 0 or width == 0:
+            return
+
+        with nogil:
+            self.c_raster.getSetBlock[rasterio_t](<rasterio_t *> &data[0, 0], xoff, yoff,
+                                      width, length, band, GDALRWFlag.GF_Write)
+
+    def memoryview(self, int band=1):
+        '''
+        Return a memoryview mapped onto the pixels of a band without reading
+        them. Only available when the GDAL driver can memory-map the band
+        (e.g., raw binary rasters); otherwise use getBlock.
+
+        Args:
+            band (Optional[int]): Band index (1-based)
+
+        Returns:
+            memoryview: 2D view of shape (length, width)
+        '''
+        return memoryview(pyRasterVirtualMem(self, band))
+
+
+cdef class pyRasterVirtualMem:
+    '''
+    Buffer protocol exporter for a memory-mapped raster band.
+    Holds a reference to the parent pyRaster to keep the dataset alive.
+
+    Args:
+        raster (pyRaster): Raster to map
+        band (Optional[int]): Band index (1-based)
+    '''
+
+    cdef CPLVirtualMem * c_vmem
+    cdef object raster
+    cdef bool readOnly
+    cdef bytes format
+    cdef Py_ssize_t shape[2]
+    cdef Py_ssize_t strides[2]
+    cdef Py_ssize_t itemsize
+
+    def __cinit__(self, pyRaster raster, int band=1):
+        cdef int pixelSpace = 0
+        cdef GIntBig lineSpace = 0
+        cdef char * options[2]
+        options[0] = b'USE_DEFAULT_IMPLEMENTATION=NO'
+        options[1] = NULL
+
+        self.c_vmem = NULL
+        self.raster = raster
+        if band < 1 or band > raster.c_raster.numBands():
+            raise ValueError('Band {0} out of range [1, {1}]'.format(
+                band, raster.c_raster.numBands()))
+
+        dtype = raster.c_raster.dtype(band)
+        if dtype not in _gdalBufferFormats:
+            raise NotImplementedError('GDAL datatype {0} cannot be exported as a '
+                                      'memoryview'.format(dtype))
+        self.format = _gdalBufferFormats[dtype]
+        self.itemsize = GDALGetDataTypeSize(dtype) // 8
+
+        self.readOnly = raster.isReadOnly
+        cdef GDALRWFlag flag = GDALRWFlag.GF_Read if self.readOnly else GDALRWFlag.GF_Write
+        cdef GDALRasterBand * c_band = raster.c_raster.dataset().GetRasterBand(band)
+        self.c_vmem = c_band.GetVirtualMemAuto(flag, &pixelSpace, &lineSpace, options)
+        if self.c_vmem == NULL:
+            raise NotImplementedError('GDAL driver cannot memory-map this raster; '
+                                      'use getBlock instead')
+
+        self.shape[0] = raster.c_raster.length()
+        self.shape[1] = raster.c_raster.width()
+        self.strides[0] = lineSpace
+        self.strides[1] = pixelSpace
+
+    def __dealloc__(self):
+        if self.c_vmem != NULL:
+            CPLVirtualMemFree(self.c_vmem)
+
+    def __getbuffer__(self, Py_buffer * buffer, int flags):
+        if (flags & PyBUF_WRITABLE) and self.readOnly:
+            raise BufferError('Raster is opened read-only')
+
+        buffer.buf = CPLVirtualMemGetAddr(self.c_vmem)
+        buffer.obj = self
+        buffer.len = self.shape[0] * self.strides[0]
+        buffer.readonly = self.readOnly
+        buffer.itemsize = self.itemsize
+        if flags & PyBUF_FORMAT:
+            buffer.format = self.format
+        else:
+            buffer.format = NULL
+        buffer.ndim = 2
+        buffer.shape = self.shape
+        buffer.strides = self.strides
+        buffer.suboffsets = NULL
+        buffer.internal = NULL
+
+    def __releasebuffer__(self, Py_buffer * buffer):
+        pass
+
 # end of file        
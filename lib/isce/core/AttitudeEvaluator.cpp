@@ -0,0 +1,211 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#include "AttitudeEvaluator.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <isce/except/Error.h>
+
+#include "EulerAngles.h"
+#include "Quaternion.h"
+
+/** @param[in] time Vector of seconds since reference epoch (increasing)
+  * @param[in] quaternions Flattened vector of quaternions per time epoch */
+isce::core::AttitudeEvaluator::
+AttitudeEvaluator(const std::vector<double> & time,
+                  const std::vector<double> & quaternions) :
+    _time(time), _qvec(quaternions) {
+
+    // Check inputs
+    const size_t n = _time.size();
+    if (n == 0 || _qvec.size() != 4 * n) {
+        throw isce::except::LengthError(ISCE_SRCINFO(),
+            "AttitudeEvaluator requires one quaternion per time epoch");
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        double * q = &_qvec[4 * i];
+
+        // Normalize
+        const double qmod = std::sqrt(q[0]*q[0] + q[1]*q[1] + q[2]*q[2] + q[3]*q[3]);
+        for (int k = 0; k < 4; ++k) {
+            q[k] /= qmod;
+        }
+
+        // Keep consecutive samples on the same hemisphere
+        if (i > 0) {
+            const double * qprev = &_qvec[4 * (i - 1)];
+            const double dot = q[0]*qprev[0] + q[1]*qprev[1] + q[2]*qprev[2] + q[3]*qprev[3];
+            if (dot < 0.0) {
+                for (int k = 0; k < 4; ++k) {
+                    q[k] = -q[k];
+                }
+            }
+            if (_time[i] <= _time[i-1]) {
+                throw isce::except::InvalidArgument(ISCE_SRCINFO(),
+                    "AttitudeEvaluator requires strictly increasing times");
+            }
+        }
+    }
+
+    // Check for uniform sampling
+    if (n > 1) {
+        _spacing = (_time[n-1] - _time[0]) / (n - 1);
+        _uniform = true;
+        for (size_t i = 1; i < n; ++i) {
+            const double expected = _time[0] + i * _spacing;
+            if (std::abs(_time[i] - expected) > 1.0e-9 * std::max(1.0, std::abs(_spacing))) {
+                _uniform = false;
+                break;
+            }
+        }
+    }
+}
+
+/** @param[in] quaternion Quaternion attitude */
+isce::core::AttitudeEvaluator::
+AttitudeEvaluator(const Quaternion & quaternion) :
+    AttitudeEvaluator(quaternion.time(), quaternion.qvec()) {}
+
+/** @param[in] euler EulerAngles attitude
+  *
+  * Each sample is converted to the quaternion of T3(yaw) T2(pitch) T1(roll) */
+isce::core::AttitudeEvaluator::
+AttitudeEvaluator(const EulerAngles & euler) :
+    AttitudeEvaluator(euler.time(), [&euler]() {
+        std::vector<double> qvec(4 * euler.nVectors());
+        for (size_t i = 0; i < euler.nVectors(); ++i) {
+            const double cy = std::cos(0.5 * euler.yaw()[i]);
+            const double sy = std::sin(0.5 * euler.yaw()[i]);
+            const double cp = std::cos(0.5 * euler.pitch()[i]);
+            const double sp = std::sin(0.5 * euler.pitch()[i]);
+            const double cr = std::cos(0.5 * euler.roll()[i]);
+            const double sr = std::sin(0.5 * euler.roll()[i]);
+            qvec[4*i + 0] = cy * cp * cr + sy * sp * sr;
+            qvec[4*i + 1] = cy * cp * sr - sy * sp * cr;
+            qvec[4*i + 2] = cy * sp * cr + sy * cp * sr;
+            qvec[4*i + 3] = sy * cp * cr - cy * sp * sr;
+        }
+        return qvec;
+    }()) {}
+
+/** @param[in] t Seconds since reference epoch */
+size_t isce::core::AttitudeEvaluator::
+_interval(double t) const {
+    const size_t n = _time.size();
+    if (n < 2 || t <= _time[0]) {
+        return 0;
+    }
+    if (t >= _time[n-1]) {
+        return n - 2;
+    }
+    if (_uniform) {
+        const size_t i = static_cast<size_t>((t - _time[0]) / _spacing);
+        return std::min(i, n - 2);
+    }
+    const auto it = std::upper_bound(_time.begin(), _time.end(), t);
+    return static_cast<size_t>(it - _time.begin()) - 1;
+}
+
+/** @param[in] t Seconds since reference epoch
+  * @param[out] q Unit quaternion (4 elements) */
+void isce::core::AttitudeEvaluator::
+quaternion(double t, double * q) const {
+
+    const size_t i = _interval(t);
+    const double * q0 = &_qvec[4 * i];
+    if (_time.size() < 2) {
+        std::copy(q0, q0 + 4, q);
+        return;
+    }
+    const double * q1 = &_qvec[4 * (i + 1)];
+
+    // Fractional position within interval (clamped outside of span)
+    double u = (t - _time[i]) / (_time[i+1] - _time[i]);
+    u = std::min(std::max(u, 0.0), 1.0);
+
+    // Angle between samples; the half-chord form stays accurate for small
+    // angles where acos of the dot product would lose precision
+    double dsum = 0.0, ssum = 0.0;
+    for (int k = 0; k < 4; ++k) {
+        dsum += (q1[k] - q0[k]) * (q1[k] - q0[k]);
+        ssum += (q1[k] + q0[k]) * (q1[k] + q0[k]);
+    }
+    const double omega = 2.0 * std::atan2(std::sqrt(dsum), std::sqrt(ssum));
+
+    // SLERP; linear weights only for (nearly) identical samples
+    double w0, w1;
+    if (omega < 1.0e-12) {
+        w0 = 1.0 - u;
+        w1 = u;
+    } else {
+        const double sinOmega = std::sin(omega);
+        w0 = std::sin((1.0 - u) * omega) / sinOmega;
+        w1 = std::sin(u * omega) / sinOmega;
+    }
+    double qmod = 0.0;
+    for (int k = 0; k < 4; ++k) {
+        q[k] = w0 * q0[k] + w1 * q1[k];
+        qmod += q[k] * q[k];
+    }
+    qmod = std::sqrt(qmod);
+    for (int k = 0; k < 4; ++k) {
+        q[k] /= qmod;
+    }
+}
+
+/** @param[in] q Unit quaternion (4 elements, scalar first) */
+isce::core::Mat3 isce::core::AttitudeEvaluator::
+quaternionToRotmat(const double * q) {
+    const double a = q[0], b = q[1], c = q[2], d = q[3];
+    return Mat3 {
+        {a*a + b*b - c*c - d*d, 2*b*c - 2*a*d, 2*b*d + 2*a*c},
+        {2*b*c + 2*a*d, a*a - b*b + c*c - d*d, 2*c*d - 2*a*b},
+        {2*b*d - 2*a*c, 2*c*d + 2*a*b, a*a - b*b - c*c + d*d}
+    };
+}
+
+/** @param[in] t Seconds since reference epoch */
+isce::core::Mat3 isce::core::AttitudeEvaluator::
+rotmat(double t) const {
+    double q[4];
+    quaternion(t, q);
+    return quaternionToRotmat(q);
+}
+
+/** @param[in] t Seconds since reference epoch
+  * @param[out] yaw Yaw angle (radians)
+  * @param[out] pitch Pitch angle (radians)
+  * @param[out] roll Roll angle (radians) */
+void isce::core::AttitudeEvaluator::
+ypr(double t, double & yaw, double & pitch, double & roll) const {
+    const cartesian_t angles = EulerAngles::rotmat2ypr(rotmat(t));
+    yaw = angles[0];
+    pitch = angles[1];
+    roll = angles[2];
+}
+
+/** @param[in] t Array of seconds since reference epoch
+  * @param[in] n Number of times
+  * @param[out] R Array of n rotation matrices */
+void isce::core::AttitudeEvaluator::
+rotmat(const double * t, size_t n, Mat3 * R) const {
+    #pragma omp parallel for
+    for (size_t i = 0; i < n; ++i) {
+        R[i] = rotmat(t[i]);
+    }
+}
+
+/** @param[in] t Vector of seconds since reference epoch
+  * @param[out] R Vector of rotation matrices (resized to match t) */
+void isce::core::AttitudeEvaluator::
+rotmat(const std::vector<double> & t, std::vector<Mat3> & R) const {
+    R.resize(t.size());
+    rotmat(t.data(), t.size(), R.data());
+}
+
+// end of file
@@ -0,0 +1,90 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#ifndef ISCE_CORE_ATTITUDEEVALUATOR_H
+#define ISCE_CORE_ATTITUDEEVALUATOR_H
+#pragma once
+
+#include "forward.h"
+
+#include <vector>
+#include "DenseMatrix.h"
+
+/** Fast attitude evaluation from sampled quaternions
+ *
+ * Quaternions are normalized once at construction and made sign-continuous
+ * so that consecutive samples lie on the same hemisphere. Lookup of the
+ * bracketing samples uses direct indexing when epochs are uniformly spaced
+ * and binary search otherwise. Attitude between samples is obtained by
+ * spherical linear interpolation (SLERP). Times outside the sampled span are
+ * clamped to the first or last sample.
+ *
+ * Quaternions are stored as (q0, q1, q2, q3) with q0 the scalar part, using
+ * the same rotation matrix convention as isce::core::Quaternion::rotmat. */
+class isce::core::AttitudeEvaluator {
+
+    public:
+        /** Default constructor */
+        AttitudeEvaluator() {}
+
+        /** Constructor from vector of times and flattened quaternions */
+        AttitudeEvaluator(const std::vector<double> & time,
+                          const std::vector<double> & quaternions);
+
+        /** Constructor from Quaternion attitude */
+        explicit AttitudeEvaluator(const Quaternion & quaternion);
+
+        /** Constructor from EulerAngles attitude (yaw-pitch-roll sequence) */
+        explicit AttitudeEvaluator(const EulerAngles & euler);
+
+        /** Number of samples */
+        inline size_t size() const { return _time.size(); }
+
+        /** Time of first sample */
+        inline double startTime() const { return _time.front(); }
+
+        /** Time of last sample */
+        inline double endTime() const { return _time.back(); }
+
+        /** Check whether samples are uniformly spaced in time */
+        inline bool uniform() const { return _uniform; }
+
+        /** Check whether a time lies inside the sampled span */
+        inline bool contains(double t) const {
+            return t >= _time.front() && t <= _time.back();
+        }
+
+        /** Interpolated unit quaternion at a given time */
+        void quaternion(double t, double * q) const;
+
+        /** Rotation matrix at a given time */
+        Mat3 rotmat(double t) const;
+
+        /** Yaw, pitch and roll at a given time */
+        void ypr(double t, double & yaw, double & pitch, double & roll) const;
+
+        /** Rotation matrices for an array of times */
+        void rotmat(const double * t, size_t n, Mat3 * R) const;
+
+        /** Rotation matrices for a vector of times */
+        void rotmat(const std::vector<double> & t, std::vector<Mat3> & R) const;
+
+        /** Rotation matrix of a unit quaternion */
+        static Mat3 quaternionToRotmat(const double * q);
+
+    private:
+        /** Index of the first sample of the interval bracketing t */
+        size_t _interval(double t) const;
+
+    private:
+        std::vector<double> _time;
+        std::vector<double> _qvec;
+        bool _uniform = false;
+        double _spacing = 0.0;
+};
+
+#endif
+
+// end of file
@@ -65,6 +65,28 @@ interpolate(double x, double y, const isce::core::Matrix<U> & z) {
     return cubicInterpolate<U>(intp[0], intp[1], intp[2], intp[3], y - y0);
 }
 
+/** @param[in] t Coordinate along the axis
+  * @param[in] n Number of samples along the axis
+  * @param[out] index Sample indices (4 values)
+  * @param[out] weight Sample weights (4 values)
+  *
+  * Coefficients of p0..p3 in cubicInterpolate() */
+template <class U>
+void
+isce::core::BicubicInterpolator<U>::
+weights(double t, int n, int * index, double * weight) const {
+    const int t0 = std::floor(t);
+    const double tfrac = t - t0;
+    const double tconj = 1.0 - tfrac;
+    for (int i = 0; i < 4; ++i) {
+        index[i] = t0 - 1 + i;
+    }
+    weight[0] = -0.5 * tfrac * tconj * tconj;
+    weight[1] = 0.5 * (tfrac * tfrac * (tfrac * 3.0 - 5.0) + 2.0);
+    weight[2] = 0.5 * (tfrac + tfrac * tfrac * (tconj * 3.0 + 1.0));
+    weight[3] = -0.5 * tconj * tfrac * tfrac;
+}
+
 // Forward declaration of classes
 template class isce::core::BicubicInterpolator<double>;
 template class isce::core::BicubicInterpolator<float>;
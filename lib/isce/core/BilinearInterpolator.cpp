@@ -48,6 +48,25 @@ interpolate(double x, double y, const isce::core::Matrix<U> & z) {
     }
 }
 
+/** @param[in] t Coordinate along the axis
+  * @param[in] n Number of samples along the axis
+  * @param[out] index Sample indices (2 values)
+  * @param[out] weight Sample weights (2 values) */
+template <class U>
+void
+isce::core::BilinearInterpolator<U>::
+weights(double t, int n, int * index, double * weight) const {
+    index[0] = std::floor(t);
+    index[1] = std::ceil(t);
+    if (index[0] == index[1]) {
+        weight[0] = 1.0;
+        weight[1] = 0.0;
+    } else {
+        weight[0] = index[1] - t;
+        weight[1] = t - index[0];
+    }
+}
+
 // Forward declaration of classes
 template class isce::core::BilinearInterpolator<double>;
 template class isce::core::BilinearInterpolator<float>;
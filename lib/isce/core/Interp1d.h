@@ -23,6 +23,22 @@ namespace isce {
         TD interp1d(const isce::core::Kernel<TK> &kernel, const TD *x,
                              size_t length, size_t stride, double t,
                              bool periodic = false);
+
+        template<typename TK, typename TD>
+        TD interp1d(const isce::core::TabulatedKernel<TK> &kernel, const TD *x,
+                    size_t length, size_t stride, double t,
+                    bool periodic = false);
+
+        template<typename TK, typename TD>
+        void interp1d(const isce::core::Kernel<TK> &kernel, const TD *x,
+                      size_t length, size_t stride, const double *t,
+                      size_t nt, TD *out, bool periodic = false);
+
+        template<typename TK, typename TD>
+        void interp1d(const isce::core::Kernel<TK> &kernel,
+                      const std::valarray<TD> &x,
+                      const std::valarray<double> &t,
+                      std::valarray<TD> &out, bool periodic = false);
     }
 }
 
@@ -59,6 +75,53 @@ TD
 isce::core::interp1d(const isce::core::Kernel<TK> &kernel,
                      const std::valarray<TD> &x, double t, bool periodic);
 
+/** Interpolate sequence x at point t using a tabulated kernel
+ *
+ * Same as the generic interface, but table lookups are inlined instead of
+ * dispatched through the virtual Kernel interface.
+ */
+template<typename TK, typename TD>
+TD
+isce::core::interp1d(const isce::core::TabulatedKernel<TK> &kernel,
+                     const TD *x, size_t length, size_t stride, double t,
+                     bool periodic);
+
+/** Interpolate sequence x at many points t
+ *
+ * @param[in]  kernel    Kernel function to use for interpolation.
+ * @param[in]  x         Sequence to interpolate.
+ * @param[in]  length    Length of sequence.
+ * @param[in]  stride    Stride between elements of sequence.
+ * @param[in]  t         Desired time samples (0 <= t[i] <= length-1).
+ * @param[in]  nt        Number of time samples.
+ * @param[out] out       Interpolated values, length nt.
+ * @param[in]  periodic  Use periodic boundary condition.  Default = false.
+ *
+ * Equivalent to out[i] = interp1d(kernel, x, length, stride, t[i]) but a
+ * TabulatedKernel is detected once per call so that every tap is an inline
+ * table lookup.
+ */
+template<typename TK, typename TD>
+void
+isce::core::interp1d(const isce::core::Kernel<TK> &kernel, const TD *x,
+                     size_t length, size_t stride, const double *t,
+                     size_t nt, TD *out, bool periodic);
+
+/** Interpolate sequence x at many points t
+ *
+ * @param[in]  kernel    Kernel function to use for interpolation.
+ * @param[in]  x         Sequence to interpolate.
+ * @param[in]  t         Desired time samples (0 <= t[i] <= x.size()-1).
+ * @param[out] out       Interpolated values, resized to t.size().
+ * @param[in]  periodic  Use periodic boundary condition.  Default = false.
+ */
+template<typename TK, typename TD>
+void
+isce::core::interp1d(const isce::core::Kernel<TK> &kernel,
+                     const std::valarray<TD> &x,
+                     const std::valarray<double> &t,
+                     std::valarray<TD> &out, bool periodic);
+
 // Get inline implementations
 #define ISCE_CORE_INTERP1D_ICC
 #include "Interp1d.icc"
@@ -34,6 +34,21 @@ class isce::core::Interpolator {
         /** Return interpolation method. */
         isce::core::dataInterpMethod method() const { return _method; }
 
+        /** Number of samples per axis used by weights(); 0 if not separable */
+        virtual int taps() const { return 0; }
+
+        /** Separable interpolation weights along one axis.
+         *
+         * @param[in] t Coordinate along the axis
+         * @param[in] n Number of samples along the axis
+         * @param[out] index Sample indices (taps() values)
+         * @param[out] weight Sample weights (taps() values)
+         *
+         * interpolate(x, y, z) is the sum of wy[i] * wx[j] * z(iy[i], ix[j]).
+         * Non-separable interpolators (taps() == 0) leave the outputs untouched. */
+        virtual void weights(double /*t*/, int /*n*/, int * /*index*/,
+                             double * /*weight*/) const {}
+
     // Protected constructor and data to be used by derived classes
     protected:
         inline Interpolator(isce::core::dataInterpMethod method) :
@@ -53,6 +68,12 @@ class isce::core::BilinearInterpolator : public isce::core::Interpolator<U> {
         /** Interpolate at a given coordinate. */
         U interpolate(double x, double y, const Matrix<U> & z);
 
+        /** Number of samples per axis used by weights() */
+        int taps() const { return 2; }
+
+        /** Separable interpolation weights along one axis */
+        void weights(double t, int n, int * index, double * weight) const;
+
         /** Interpolate at a given coordinate for data passed as a valarray */
         U interpolate(double x, double y, std::valarray<U> & z_data, size_t width) {
             isce::core::Matrix<U> z(z_data, width);
@@ -77,6 +98,12 @@ class isce::core::BicubicInterpolator : public isce::core::Interpolator<U> {
         /** Interpolate at a given coordinate. */
         U interpolate(double x, double y, const Matrix<U> & z);
 
+        /** Number of samples per axis used by weights() */
+        int taps() const { return 4; }
+
+        /** Separable interpolation weights along one axis */
+        void weights(double t, int n, int * index, double * weight) const;
+
         /** Interpolate at a given coordinate for data passed as a valarray */
         U interpolate(double x, double y, std::valarray<U> & z_data, size_t width) {
             isce::core::Matrix<U> z(z_data, width);
@@ -102,6 +129,12 @@ class isce::core::NearestNeighborInterpolator : public isce::core::Interpolator<
         /** Interpolate at a given coordinate. */
         U interpolate(double x, double y, const Matrix<U> & z);
 
+        /** Number of samples per axis used by weights() */
+        int taps() const { return 1; }
+
+        /** Separable interpolation weights along one axis */
+        void weights(double t, int n, int * index, double * weight) const;
+
         /** Interpolate at a given coordinate for data passed as a valarray */
         U interpolate(double x, double y, std::valarray<U> & z_data, size_t width) {
             isce::core::Matrix<U> z(z_data, width);
@@ -129,6 +162,12 @@ class isce::core::Spline2dInterpolator : public isce::core::Interpolator<U> {
         /** Interpolate at a given coordinate. */
         U interpolate(double x, double y, const Matrix<U> & z);
 
+        /** Number of samples per axis used by weights() */
+        int taps() const { return _order; }
+
+        /** Separable interpolation weights along one axis */
+        void weights(double t, int n, int * index, double * weight) const;
+
         /** Interpolate at a given coordinate for data passed as a valarray */
         U interpolate(double x, double y, std::valarray<U> & z_data, size_t width) {
             isce::core::Matrix<U> z(z_data, width);
@@ -147,15 +186,17 @@ class isce::core::Spline2dInterpolator : public isce::core::Interpolator<U> {
 
     // Utility spline functions
     private:
-        void _initSpline(const std::valarray<U> &,
+        template <typename V>
+        static void _initSpline(const std::valarray<V> &,
+                                int,
+                                std::valarray<V> &,
+                                std::valarray<V> &);
+
+        template <typename V>
+        static V _spline(double,
+                         const std::valarray<V> &,
                          int,
-                         std::valarray<U> &,
-                         std::valarray<U> &);
-
-        U _spline(double,
-                  const std::valarray<U> &,
-                  int,
-                  const std::valarray<U> &);
+                         const std::valarray<V> &);
 };
 
 /** Definition of Sinc2dInterpolator */
@@ -181,6 +222,12 @@ class isce::core::Sinc2dInterpolator : public isce::core::Interpolator<U> {
             return interpolate(x, y, z);
         }
 
+        /** Number of samples per axis used by weights() */
+        int taps() const { return _kernelWidth; }
+
+        /** Separable interpolation weights along one axis */
+        void weights(double t, int n, int * index, double * weight) const;
+
     private:
         // Compute sinc coefficients 
         void _sinc_coef(double beta, double relfiltlen, int decfactor, double pedestal,
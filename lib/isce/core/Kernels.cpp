@@ -8,6 +8,7 @@
 #include <isce/except/Error.h>
 #include <complex>
 #include <cmath>
+#include <limits>
 #include <type_traits>
 
 using isce::except::RuntimeError;
@@ -137,3 +138,32 @@ operator()(double t) const
 
 template class isce::core::NFFTKernel<float>;
 template class isce::core::NFFTKernel<double>;
+
+/*
+ * Tabulated
+ */
+
+// constructor
+template <typename T>
+isce::core::TabulatedKernel<T>::
+TabulatedKernel(const isce::core::Kernel<T> &kernel, size_t n, bool cubic)
+    : _n(n), _cubic(cubic)
+{
+    if (n < 4) {
+        throw RuntimeError(ISCE_SRCINFO(), "Require at least 4 table samples.");
+    }
+    this->_halfwidth = kernel.width() / 2;
+    const double dx = this->_halfwidth / (n - 1);
+    _1_dx = 1.0 / dx;
+    // Sample kernel on [0, halfwidth].
+    _table.resize(n + 2);
+    for (size_t i=0; i<n; ++i) {
+        _table[i+1] = kernel(i * dx);
+    }
+    // Pad start using symmetry and end using cubic extrapolation.
+    _table[0] = _table[2];
+    _table[n+1] = 4*_table[n] - 6*_table[n-1] + 4*_table[n-2] - _table[n-3];
+}
+
+template class isce::core::TabulatedKernel<float>;
+template class isce::core::TabulatedKernel<double>;
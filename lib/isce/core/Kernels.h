@@ -9,6 +9,8 @@
 
 #include "forward.h"
 
+#include <algorithm>
+#include <cmath>
 #include <valarray>
 #include <isce/math/Bessel.h>
 
@@ -124,4 +126,68 @@ class isce::core::NFFTKernel : public isce::core::Kernel<T> {
         T _b;
 };
 
+/** Kernel sampled onto an oversampled lookup table.
+ *
+ * The source kernel is evaluated once at construction on a uniform grid
+ * spanning [0, halfwidth], and calls interpolate the table with either linear
+ * or cubic (4-point Lagrange) weights.  The source kernel is assumed to be
+ * symmetric, which holds for all ISCE kernels.  Calls outside the support are
+ * clamped to the end of the table.
+ */
+template <typename T>
+class isce::core::TabulatedKernel final : public isce::core::Kernel<T> {
+
+    public:
+        /** Constructor of tabulated kernel.
+         *
+         * @param[in] kernel    Kernel to sample.
+         * @param[in] n         Number of table samples in [0, halfwidth].
+         * @param[in] cubic     Use cubic instead of linear table lookup.
+         */
+        TabulatedKernel(const isce::core::Kernel<T> &kernel, size_t n,
+                        bool cubic = false);
+
+        inline T operator()(double x) const override;
+
+        /** Get number of table samples in [0, halfwidth]. */
+        size_t size() const {return _n;}
+
+        /** Check if table uses cubic lookup. */
+        bool cubic() const {return _cubic;}
+
+    private:
+        // Table with one padding sample on each end for cubic lookup.
+        std::valarray<T> _table;
+        size_t _n;
+        double _1_dx;
+        bool _cubic;
+};
+
+// call
+template <typename T>
+inline T
+isce::core::TabulatedKernel<T>::
+operator()(double x) const
+{
+    // Zero outside the support of the kernel.
+    const double ax = std::abs(x);
+    if (ax > this->_halfwidth) {
+        return 0;
+    }
+    double u = std::min(ax * _1_dx, (double) (_n - 1));
+    size_t i = std::min((size_t) u, _n - 2);
+    T f = u - i;
+    // Skip padding sample at start of table.
+    const T *y = &_table[i+1];
+    if (!_cubic) {
+        return y[0] + f * (y[1] - y[0]);
+    }
+    // 4-point Lagrange weights on nodes i-1, i, i+1, i+2.
+    const T fm1 = f - 1, fm2 = f - 2, fp1 = f + 1;
+    return (-f * fm1 * fm2 * y[-1]
+            + 3 * fp1 * fm1 * fm2 * y[0]
+            - 3 * fp1 * f * fm2 * y[1]
+            + fp1 * f * fm1 * y[2]) / 6;
+}
+
 #endif
@@ -11,6 +11,7 @@
 
 #include "forward.h"
 
+#include <algorithm>
 #include <valarray>
 
 /** Data structure to hold a 1D Lookup table.
@@ -25,13 +26,16 @@ class isce::core::LUT1d {
             std::valarray<double> y{0.0, 0.0};
             _coords = x;
             _values = y;
+            _checkUniform();
         }
 
         /** Constructor with a constant reference value */
-        inline LUT1d(T refValue) : _haveData(false), _refValue(refValue), _extrapolate{true} {}
+        inline LUT1d(T refValue) : _haveData(false), _refValue(refValue), _extrapolate{true},
+                                   _uniform(false) {}
 
         /** Constructor with size */
-        inline LUT1d(size_t size) : _haveData(false), _refValue(0.0), _extrapolate{true} {
+        inline LUT1d(size_t size) : _haveData(false), _refValue(0.0), _extrapolate{true},
+                                    _uniform(false) {
             _coords.resize(size);
             _values.resize(size);
         }
@@ -46,7 +50,9 @@ class isce::core::LUT1d {
                      _refValue(values[0]),
                      _coords(coords),
                      _values(values),
-                     _extrapolate{extrapolate} {}
+                     _extrapolate{extrapolate} {
+            _checkUniform();
+        }
 
         /** Copy constructor. 
           * @param[in] lut LUT1d object to copy from */
@@ -55,7 +61,9 @@ class isce::core::LUT1d {
             _refValue(lut.refValue()),
             _coords(lut.coords()),
             _values(lut.values()),
-            _extrapolate(lut.extrapolate()) {}
+            _extrapolate(lut.extrapolate()) {
+            _checkUniform();
+        }
 
         /** Assignment operator. 
           * @param[in] lut LUT1d object to assign from */
@@ -65,6 +73,7 @@ class isce::core::LUT1d {
             _coords = lut.coords();
             _values = lut.values();
             _extrapolate = lut.extrapolate();
+            _checkUniform();
             return *this;
         }
 
@@ -75,8 +84,14 @@ class isce::core::LUT1d {
         inline LUT1d & operator=(const LUT2d<T> & lut2d);
 
         /** Get a reference to the coordinates
-          * @param[out] coords Reference to valarray for coordinates */
-        inline std::valarray<double> & coords() { return _coords; }
+          * @param[out] coords Reference to valarray for coordinates
+          *
+          * Coordinates may be modified through the reference, so the uniform grid
+          * fast path is disabled until coordinates are set with coords(c). */
+        inline std::valarray<double> & coords() {
+            _uniform = false;
+            return _coords;
+        }
 
         /** Get a read-only reference to the coordinates 
           * @param[out] coords Copy of valarray for coordinates */
@@ -84,7 +99,10 @@ class isce::core::LUT1d {
 
         /** Set the coordinates 
           * @param[in] c Input valarray for coordinates */ 
-        inline void coords(const std::valarray<double> & c) { _coords = c; }
+        inline void coords(const std::valarray<double> & c) {
+            _coords = c;
+            _checkUniform();
+        }
 
         /** Get a reference to the coordinates
           * @param[out] values Reference to valarray for values */
@@ -116,9 +134,29 @@ class isce::core::LUT1d {
           * @param[out] size Size (number of coordinates) of LUT */
         inline size_t size() const { return _coords.size(); }
 
+        /** Check if coordinates are uniformly spaced (enables O(1) indexing) */
+        inline bool uniform() const { return _uniform; }
+
         /** Evaluate the LUT */
         inline T eval(double x) const;
 
+        /** Evaluate the LUT at many coordinates */
+        inline void evalBatch(const double * x, size_t n, T * out) const;
+
+        /** Evaluate the LUT at many coordinates */
+        inline void evalBatch(const std::valarray<double> & x,
+                              std::valarray<T> & out) const;
+
+    private:
+        /** Detect uniform spacing of coordinates */
+        inline void _checkUniform();
+
+        /** Index of left coordinate of interval containing x (within bounds) */
+        inline size_t _search(double x) const;
+
+        /** Linear interpolation within the interval starting at index j0 */
+        inline T _interpolate(double x, size_t j0) const;
+
     // Data members
     private:
         bool _haveData;
@@ -126,6 +164,9 @@ class isce::core::LUT1d {
         std::valarray<double> _coords;
         std::valarray<T> _values;
         bool _extrapolate;
+        // Uniform grid parameters
+        bool _uniform;
+        double _1_dx;
 };
 
 // Get inline implementations for LUT1d
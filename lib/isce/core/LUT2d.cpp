@@ -6,6 +6,7 @@
 
 #include "LUT2d.h"
 
+#include <algorithm>
 #include <complex>
 
 // Constructor with coordinate starting values and spacing
@@ -119,6 +120,21 @@ eval(double y, double x) const {
     double y_idx = (y - _ystart) / _dy;
 
     // Check bounds or clamp indices to valid values
+    _checkBounds(y, x, y_idx, x_idx);
+
+    // Call interpolator
+    value = _interp->interpolate(x_idx, y_idx, _data);
+    return value;
+}
+
+// Check bounds or clamp indices to valid values
+/** @param[in] y Y-coordinate for evaluation
+  * @param[in] x X-coordinate for evaluation
+  * @param[in,out] y_idx Fractional row index
+  * @param[in,out] x_idx Fractional column index */
+template <typename T>
+void isce::core::LUT2d<T>::
+_checkBounds(double y, double x, double & y_idx, double & x_idx) const {
     if (_boundsError) {
         if (x_idx < 0.0 || y_idx < 0.0 || x_idx >= _data.width() || y_idx >= _data.length()) {
             pyre::journal::error_t errorChannel("isce.core.LUT2d");
@@ -129,14 +145,104 @@ eval(double y, double x) const {
                 << _xstart << " " << _xstart + _dx*_data.width()
                 << pyre::journal::endl;
         }
-    } else {
-        x_idx = isce::core::clamp(x_idx, 0.0, _data.width() - 1.0);
-        y_idx = isce::core::clamp(y_idx, 0.0, _data.length() - 1.0);
-    } 
+    }
+    // Out-of-bounds points that are only reported still evaluate at the edge
+    x_idx = isce::core::clamp(x_idx, 0.0, _data.width() - 1.0);
+    y_idx = isce::core::clamp(y_idx, 0.0, _data.length() - 1.0);
+}
 
-    // Call interpolator
-    value = _interp->interpolate(x_idx, y_idx, _data);
-    return value;
+// Evaluate LUT at fixed Y-coordinate along a line of X-coordinates
+/** @param[in] y Y-coordinate for evaluation
+  * @param[in] n Number of X-coordinates
+  * @param[in] xcoord Callable returning the i-th X-coordinate
+  * @param[out] out Interpolated values
+  *
+  * For bilinear interpolation the two bracketing rows are located once and
+  * each point is interpolated directly from them, avoiding per-point virtual
+  * calls and any scratch storage. Other methods fall back to eval for each
+  * point, as do points outside the grid when bounds errors are enabled, so
+  * out-of-bounds handling is identical to eval. */
+template <typename T>
+template <typename XCoord>
+void isce::core::LUT2d<T>::
+_evalLine(double y, size_t n, XCoord xcoord, T * out) const {
+
+    // Check if data are available; if not, fill with ref value
+    if (!_haveData || n == 0) {
+        std::fill(out, out + n, _refValue);
+        return;
+    }
+
+    // Fractional row index; clamped as in eval when bounds errors are disabled
+    const double ymax = _data.length() - 1.0;
+    double y_idx = (y - _ystart) / _dy;
+    if (!_boundsError) {
+        y_idx = isce::core::clamp(y_idx, 0.0, ymax);
+    }
+
+    // Other interpolators and rows outside the grid go through the generic path
+    if (_interp->method() != isce::core::BILINEAR_METHOD || y_idx < 0.0 || y_idx > ymax) {
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = eval(y, xcoord(i));
+        }
+        return;
+    }
+
+    // Rows bracketing this Y-coordinate and their weights
+    const size_t i1 = static_cast<size_t>(std::floor(y_idx));
+    const size_t i2 = static_cast<size_t>(std::ceil(y_idx));
+    const T * r1 = _data.rowptr(i1);
+    const T * r2 = _data.rowptr(i2);
+    const T w2 = static_cast<T>(y_idx - i1);
+    const T w1 = static_cast<T>(1.0) - w2;
+
+    // Linear interpolation along both rows, then between them
+    const double xmax = _data.width() - 1.0;
+    const size_t jmax = (_data.width() > 1) ? _data.width() - 2 : 0;
+    for (size_t i = 0; i < n; ++i) {
+        const double x = xcoord(i);
+        double idx = (x - _xstart) / _dx;
+        if (!_boundsError) {
+            idx = isce::core::clamp(idx, 0.0, xmax);
+        } else if (idx < 0.0 || idx > xmax) {
+            out[i] = eval(y, x);
+            continue;
+        }
+        if (_data.width() == 1) {
+            out[i] = w1 * r1[0] + w2 * r2[0];
+            continue;
+        }
+        const size_t j = std::min(static_cast<size_t>(idx), jmax);
+        const T w = static_cast<T>(idx - j);
+        const T v1 = r1[j] + w * (r1[j+1] - r1[j]);
+        const T v2 = r2[j] + w * (r2[j+1] - r2[j]);
+        out[i] = w1 * v1 + w2 * v2;
+    }
+}
+
+// Evaluate LUT at fixed Y-coordinate for many X-coordinates
+/** @param[in] y Y-coordinate for evaluation
+  * @param[in] x X-coordinates for evaluation
+  * @param[in] n Number of X-coordinates
+  * @param[out] out Interpolated values */
+template <typename T>
+void isce::core::LUT2d<T>::
+evalBatch(double y, const double * x, size_t n, T * out) const {
+    _evalLine(y, n, [x](size_t i) { return x[i]; }, out);
+}
+
+// Evaluate LUT at fixed Y-coordinate for uniformly spaced X-coordinates
+/** @param[in] y Y-coordinate for evaluation
+  * @param[in] xstart First X-coordinate
+  * @param[in] dx Spacing of X-coordinates
+  * @param[in] n Number of X-coordinates
+  * @param[out] out Interpolated values
+  *
+  * X-coordinates are generated on the fly, so no temporary is allocated. */
+template <typename T>
+void isce::core::LUT2d<T>::
+evalRow(double y, double xstart, double dx, size_t n, T * out) const {
+    _evalLine(y, n, [xstart, dx](size_t i) { return xstart + i * dx; }, out);
 }
 
 // Forward declaration of classes
@@ -78,9 +78,16 @@ class isce::core::LUT2d {
         // Set bounds error floag
         inline void boundsError(bool flag) { _boundsError = flag; }
               
-        // Evaluate LUT    
+        // Evaluate LUT; out-of-bounds points are reported when bounds errors
+        // are enabled and evaluate at the nearest edge of the grid
         T eval(double y, double x) const;
 
+        // Evaluate LUT at fixed Y-coordinate for many X-coordinates
+        void evalBatch(double y, const double * x, size_t n, T * out) const;
+
+        // Evaluate LUT at fixed Y-coordinate for uniformly spaced X-coordinates
+        void evalRow(double y, double xstart, double dx, size_t n, T * out) const;
+
     private:
         // Flags
         bool _haveData, _boundsError;
@@ -94,6 +101,13 @@ class isce::core::LUT2d {
     private:
         inline void _setInterpolator(isce::core::dataInterpMethod method);
 
+        // Check bounds or clamp index for a single coordinate
+        void _checkBounds(double y, double x, double & y_idx, double & x_idx) const;
+
+        // Evaluate at fixed y for n X-coordinates given by xcoord(i)
+        template <typename XCoord>
+        void _evalLine(double y, size_t n, XCoord xcoord, T * out) const;
+
     // BVR: I'm placing the comparison operator implementations inline here because
     // it wasn't clear to me how to handle the template arguments out-of-line
     public:
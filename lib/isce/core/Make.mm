@@ -8,6 +8,7 @@ PACKAGE = isce/core
 # the list of sources
 PROJ_SRCS = \
     Attitude.cpp \
+    AttitudeEvaluator.cpp \
     Baseline.cpp \
     BilinearInterpolator.cpp \
     BicubicInterpolator.cpp \
@@ -40,6 +41,7 @@ EXPORT_LIBS = $(PROJ_DLL)
 # the headers
 EXPORT_PKG_HEADERS = \
     Attitude.h \
+    AttitudeEvaluator.h \
     Baseline.h \
     Basis.h \
     Constants.h \
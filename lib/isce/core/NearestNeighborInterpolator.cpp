@@ -22,6 +22,18 @@ interpolate(double x, double y, const isce::core::Matrix<U> & z) {
     return z(row, col);
 }
 
+/** @param[in] t Coordinate along the axis
+  * @param[in] n Number of samples along the axis
+  * @param[out] index Sample index (1 value)
+  * @param[out] weight Sample weight (1 value) */
+template <class U>
+void
+isce::core::NearestNeighborInterpolator<U>::
+weights(double t, int n, int * index, double * weight) const {
+    index[0] = static_cast<int>(std::round(t));
+    weight[0] = 1.0;
+}
+
 // Forward declaration of classes
 template class isce::core::NearestNeighborInterpolator<double>;
 template class isce::core::NearestNeighborInterpolator<float>;
@@ -40,6 +40,9 @@ class isce::core::Quaternion : public isce::core::Attitude {
                                 const cartesian_t &,
                                 Ellipsoid *);
 
+        /** Return data vector of time */
+        inline const std::vector<double> & time() const { return _time; }
+
         /** Get a copy of the quaternion elements*/
         inline std::vector<double> qvec() const { return _qvec; };
 
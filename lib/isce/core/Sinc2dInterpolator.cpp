@@ -97,6 +97,33 @@ _sinc_eval_2d(const isce::core::Matrix<U> & arrin, int intpx, int intpy,
     return ret;
 }
 
+/** @param[in] t Coordinate along the axis
+  * @param[in] n Number of samples along the axis
+  * @param[out] index Sample indices (sincLen values)
+  * @param[out] weight Sample weights (sincLen values)
+  *
+  * Kernel row used by _sinc_eval_2d(). Weights are zero for coordinates where
+  * interpolate() returns zero. */
+template <class U>
+void
+isce::core::Sinc2dInterpolator<U>::
+weights(double t, int n, int * index, double * weight) const {
+
+    // Separate coordinate into integer and fractional components
+    const int it = static_cast<int>(std::floor(t));
+    const double ft = t - it;
+
+    // Check edge conditions
+    const bool outside = (it < (_sincHalf - 1)) || (it > (n - _sincHalf - 1));
+
+    // Nearest kernel index
+    const int ifrac = std::min(std::max(0, int(ft*_kernelLength)), _kernelLength-1);
+    for (int i = 0; i < _kernelWidth; ++i) {
+        index[i] = std::min(std::max(it + _sincHalf - i, 0), n - 1);
+        weight[i] = outside ? 0.0 : _kernel(ifrac, i);
+    }
+}
+
 template <class U>
 void
 isce::core::Sinc2dInterpolator<U>::
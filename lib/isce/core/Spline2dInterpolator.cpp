@@ -68,42 +68,75 @@ interpolate(double x, double y, const isce::core::Matrix<U> & z) {
 }
 
 template <typename U>
-U isce::core::Spline2dInterpolator<U>::
-_spline(double x, const std::valarray<U> & Y, int n, const std::valarray<U> & R) {
+template <typename V>
+V isce::core::Spline2dInterpolator<U>::
+_spline(double x, const std::valarray<V> & Y, int n, const std::valarray<V> & R) {
 
-    const U denom = static_cast<U>(6.0);
+    const V denom = static_cast<V>(6.0);
     if (x < 1.0) {
-        return Y[0] + static_cast<U>(x - 1.0) * (Y[1] - Y[0] - (R[1] / denom));
+        return Y[0] + static_cast<V>(x - 1.0) * (Y[1] - Y[0] - (R[1] / denom));
     } else if (x > n) {
-        return Y[n-1] + (static_cast<U>(x - n) * (Y[n-1] - Y[n-2] + (R[n-2] / denom)));
+        return Y[n-1] + (static_cast<V>(x - n) * (Y[n-1] - Y[n-2] + (R[n-2] / denom)));
     } else {
         int j = int(std::floor(x));
-        U xx = static_cast<U>(x - j);
-        auto t0 = Y[j] - Y[j-1] - (R[j-1] / static_cast<U>(3.0)) - (R[j] / denom);
-        auto t1 = xx * ((R[j-1] / static_cast<U>(2.0)) + (xx * ((R[j] - R[j-1]) / denom)));
+        V xx = static_cast<V>(x - j);
+        auto t0 = Y[j] - Y[j-1] - (R[j-1] / static_cast<V>(3.0)) - (R[j] / denom);
+        auto t1 = xx * ((R[j-1] / static_cast<V>(2.0)) + (xx * ((R[j] - R[j-1]) / denom)));
         return Y[j-1] + (xx * (t0 + t1));
     }
 }
 
 template <typename U>
+template <typename V>
 void isce::core::Spline2dInterpolator<U>::
-_initSpline(const std::valarray<U> & Y, int n, std::valarray<U> & R,
-            std::valarray<U> & Q) {
-    Q[0] = U(0.0);
-    R[0] = U(0.0);
+_initSpline(const std::valarray<V> & Y, int n, std::valarray<V> & R,
+            std::valarray<V> & Q) {
+    Q[0] = V(0.0);
+    R[0] = V(0.0);
     for (int i = 1; i < n - 1; ++i) {
-        const U p = static_cast<U>(1.0) / 
-                   (static_cast<U>(0.5) * Q[i-1] + static_cast<U>(2.0));
-        Q[i] = static_cast<U>(-0.5) * p;
-        R[i] = (static_cast<U>(3.0) * 
-                (Y[i+1] - static_cast<U>(2.0) * Y[i] + Y[i-1]) - 
-                 static_cast<U>(0.5) * R[i-1]) * p;
+        const V p = static_cast<V>(1.0) / 
+                   (static_cast<V>(0.5) * Q[i-1] + static_cast<V>(2.0));
+        Q[i] = static_cast<V>(-0.5) * p;
+        R[i] = (static_cast<V>(3.0) * 
+                (Y[i+1] - static_cast<V>(2.0) * Y[i] + Y[i-1]) - 
+                 static_cast<V>(0.5) * R[i-1]) * p;
     }
-    R[n-1] = U(0.0);
+    R[n-1] = V(0.0);
     for (int i = (n - 2); i > 0; --i)
         R[i] = Q[i] * R[i+1] + R[i];
 }
 
+/** @param[in] t Coordinate along the axis
+  * @param[in] n Number of samples along the axis
+  * @param[out] index Sample indices (order values)
+  * @param[out] weight Sample weights (order values)
+  *
+  * The spline is linear in the data, so the weight of each sample is the spline
+  * evaluated for unit data at that sample. Indices are clamped as in interpolate(). */
+template <class U>
+void
+isce::core::Spline2dInterpolator<U>::
+weights(double t, int n, int * index, double * weight) const {
+
+    // Start of spline window
+    int i0;
+    if ((_order % 2) != 0) {
+        i0 = t - 0.5;
+    } else {
+        i0 = t;
+    }
+    i0 = i0 - (_order / 2) + 1;
+
+    std::valarray<double> A(0.0, _order), R(_order), Q(_order);
+    for (int i = 0; i < _order; ++i) {
+        index[i] = std::min(std::max(i0 + i, 0), n - 2) + 1;
+        A[i] = 1.0;
+        _initSpline(A, _order, R, Q);
+        weight[i] = _spline(t - i0, A, _order, R);
+        A[i] = 0.0;
+    }
+}
+
 // Forward declaration of classes
 template class isce::core::Spline2dInterpolator<double>;
 template class isce::core::Spline2dInterpolator<float>;
@@ -4,6 +4,7 @@ namespace isce {
     namespace core {
         // plain classes
         class Attitude;
+        class AttitudeEvaluator;
         class Baseline;
         class Basis;
         class DateTime;
@@ -40,6 +41,7 @@ namespace isce {
         template<class> class KnabKernel;
         template<class> class LinearKernel;
         template<class> class NFFTKernel;
+        template<class> class TabulatedKernel;
 
         // using-declarations
         using Mat3 = DenseMatrix<3>;
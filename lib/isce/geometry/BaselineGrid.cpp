@@ -0,0 +1,191 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#include <algorithm>
+#include <cmath>
+
+// isce::except
+#include <isce/except/Error.h>
+
+// isce::geometry
+#include "BaselineGrid.h"
+
+using isce::core::Vec3;
+
+/** @param[in] radarGrid RadarGridParameters defining lines and range bins
+  * @param[in] heights Heights above ellipsoid of cube slices (increasing)
+  * @param[in] azimuthDecimation Lines between coarse grid nodes
+  * @param[in] rangeDecimation Range bins between coarse grid nodes */
+isce::geometry::BaselineGrid::
+BaselineGrid(const isce::product::RadarGridParameters & radarGrid,
+             const std::vector<double> & heights,
+             size_t azimuthDecimation,
+             size_t rangeDecimation) :
+    BaselineGrid(radarGrid.sensingStart(),
+                 radarGrid.numberAzimuthLooks() / radarGrid.prf(),
+                 radarGrid.length(),
+                 radarGrid.startingRange(),
+                 radarGrid.numberRangeLooks() * radarGrid.rangePixelSpacing(),
+                 radarGrid.width(),
+                 heights, azimuthDecimation, rangeDecimation) {}
+
+/** @param[in] azimuthStart Azimuth time of first line
+  * @param[in] azimuthSpacing Azimuth time between lines
+  * @param[in] length Number of lines
+  * @param[in] startingRange Slant range of first range bin
+  * @param[in] rangeSpacing Slant range between range bins
+  * @param[in] width Number of range bins
+  * @param[in] heights Heights above ellipsoid of cube slices (increasing)
+  * @param[in] azimuthDecimation Lines between coarse grid nodes
+  * @param[in] rangeDecimation Range bins between coarse grid nodes */
+isce::geometry::BaselineGrid::
+BaselineGrid(double azimuthStart, double azimuthSpacing, size_t length,
+             double startingRange, double rangeSpacing, size_t width,
+             const std::vector<double> & heights,
+             size_t azimuthDecimation,
+             size_t rangeDecimation) :
+    RadarGridCube(azimuthStart, azimuthSpacing, length,
+                  startingRange, rangeSpacing, width,
+                  heights, azimuthDecimation, rangeDecimation) {
+
+    // Baselines on the coarse nodes
+    _bperp.resize(heights.size(), coarseLength(), coarseWidth());
+    _bpar.resize(heights.size(), coarseLength(), coarseWidth());
+    _bperp.zeros();
+    _bpar.zeros();
+}
+
+/** @param[in] orbit Reference orbit
+  * @param[in] ellipsoid Ellipsoid object
+  * @param[in] lookSide +1 for left and -1 for right
+  * @param[in] orbitMethod Orbit interpolation method (reference and secondary) */
+void isce::geometry::BaselineGrid::
+computeReferenceGeometry(const isce::core::Orbit & orbit,
+                         const isce::core::Ellipsoid & ellipsoid,
+                         int lookSide,
+                         isce::core::orbitInterpMethod orbitMethod) {
+
+    _orbitMethod = orbitMethod;
+    _computeTargets(orbit, ellipsoid, lookSide, orbitMethod);
+}
+
+/** @param[in] secondaryOrbit Secondary orbit, interpolated with the method
+  *            given to computeReferenceGeometry
+  * @param[in] threshold Azimuth time convergence threshold (seconds)
+  * @param[in] maxIter Maximum number of Newton iterations per node */
+void isce::geometry::BaselineGrid::
+computeBaselines(const isce::core::Orbit & secondaryOrbit, double threshold, int maxIter) {
+
+    if (!_haveTargets()) {
+        throw isce::except::RuntimeError(ISCE_SRCINFO(),
+            "BaselineGrid reference geometry has not been computed");
+    }
+
+    const size_t nheights = heights().size();
+    const size_t nrows = coarseLength();
+    const size_t ncols = coarseWidth();
+
+    #pragma omp parallel for schedule(dynamic)
+    for (size_t row = 0; row < nrows; ++row) {
+
+        const double * p = _platformPosition(row);
+        const double * v = _platformVelocity(row);
+        const Vec3 refPos{p[0], p[1], p[2]};
+        const Vec3 refVel{v[0], v[1], v[2]};
+
+        // Initial guess for the secondary zero-Doppler time of the first node
+        double aztime = coarseAzimuthTime(row);
+
+        for (size_t k = 0; k < nheights; ++k) {
+            for (size_t col = 0; col < ncols; ++col) {
+
+                const double * t = _targetXYZ(k, row, col);
+                const Vec3 target{t[0], t[1], t[2]};
+
+                // Zero-Doppler Newton iterations warm-started from previous node
+                Vec3 secPos, secVel;
+                for (int iter = 0; iter < maxIter; ++iter) {
+                    secondaryOrbit.interpolate(aztime, secPos, secVel, _orbitMethod);
+                    const Vec3 dr = target - secPos;
+                    const double dt = dr.dot(secVel) / secVel.dot(secVel);
+                    aztime += dt;
+                    if (std::abs(dt) < threshold) {
+                        break;
+                    }
+                }
+                secondaryOrbit.interpolate(aztime, secPos, secVel, _orbitMethod);
+
+                // Baseline components
+                const Vec3 refLook = target - refPos;
+                const Vec3 secLook = target - secPos;
+                const Vec3 baseline = secPos - refPos;
+                const double bpar = secLook.norm() - refLook.norm();
+                const double b2 = baseline.dot(baseline);
+                const double sign = (refLook.cross(baseline).dot(refVel) >= 0.0) ? 1.0 : -1.0;
+                const double bperp = sign * std::sqrt(std::max(b2 - bpar * bpar, 0.0));
+
+                _bperp(k, row, col) = static_cast<float>(bperp);
+                _bpar(k, row, col) = static_cast<float>(bpar);
+            }
+        }
+    }
+}
+
+/** @param[in] line Line index
+  * @param[in] height Height above ellipsoid
+  * @param[out] bperp Perpendicular baselines for range bins [0, width)
+  * @param[out] bpar Parallel baselines for range bins [0, width) */
+void isce::geometry::BaselineGrid::
+baselineLine(size_t line, double height, double * bperp, double * bpar) const {
+
+    // Azimuth and height weights are shared by the whole line
+    const double y = static_cast<double>(line) / azimuthDecimation();
+    const size_t row = std::min(static_cast<size_t>(y), coarseLength() - 2);
+    const double ty = y - row;
+    size_t k;
+    double tz;
+    _heightIndex(height, k, tz);
+    const size_t k1 = std::min(k + 1, heights().size() - 1);
+
+    // Collapse the cube to a single coarse line
+    const size_t ncols = coarseWidth();
+    std::vector<double> perpLine(ncols), parLine(ncols);
+    const double w[4] = {(1.0 - tz) * (1.0 - ty), (1.0 - tz) * ty, tz * (1.0 - ty), tz * ty};
+    const float * perp[4] = {&_bperp(k, row, 0), &_bperp(k, row+1, 0),
+                             &_bperp(k1, row, 0), &_bperp(k1, row+1, 0)};
+    const float * par[4] = {&_bpar(k, row, 0), &_bpar(k, row+1, 0),
+                            &_bpar(k1, row, 0), &_bpar(k1, row+1, 0)};
+    for (size_t col = 0; col < ncols; ++col) {
+        perpLine[col] = w[0] * perp[0][col] + w[1] * perp[1][col]
+                      + w[2] * perp[2][col] + w[3] * perp[3][col];
+        parLine[col] = w[0] * par[0][col] + w[1] * par[1][col]
+                     + w[2] * par[2][col] + w[3] * par[3][col];
+    }
+
+    // Linear interpolation in range
+    const size_t rdec = rangeDecimation();
+    for (size_t rbin = 0; rbin < width(); ++rbin) {
+        const size_t col = std::min(rbin / rdec, ncols - 2);
+        const double tx = static_cast<double>(rbin) / rdec - col;
+        bperp[rbin] = (1.0 - tx) * perpLine[col] + tx * perpLine[col+1];
+        bpar[rbin] = (1.0 - tx) * parLine[col] + tx * parLine[col+1];
+    }
+}
+
+/** @param[in] line Line index
+  * @param[in] height Height above ellipsoid
+  * @param[out] bperp Perpendicular baselines for range bins [0, width)
+  * @param[out] bpar Parallel baselines for range bins [0, width) */
+void isce::geometry::BaselineGrid::
+baselineLine(size_t line, double height, std::valarray<double> & bperp,
+             std::valarray<double> & bpar) const {
+    if (bperp.size() != width())
+        bperp.resize(width());
+    if (bpar.size() != width())
+        bpar.resize(width());
+    baselineLine(line, height, &bperp[0], &bpar[0]);
+}
+
+// end of file
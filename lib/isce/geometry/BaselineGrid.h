@@ -0,0 +1,149 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#ifndef ISCE_GEOMETRY_BASELINEGRID_H
+#define ISCE_GEOMETRY_BASELINEGRID_H
+
+#include <algorithm>
+#include <cmath>
+#include <valarray>
+#include <vector>
+
+// isce::core
+#include <isce/core/Constants.h>
+#include <isce/core/Cube.h>
+#include <isce/core/Ellipsoid.h>
+#include <isce/core/Orbit.h>
+
+// isce::product
+#include <isce/product/RadarGridParameters.h>
+
+// isce::geometry
+#include "RadarGridCube.h"
+
+// Declaration
+namespace isce {
+    namespace geometry {
+        class BaselineGrid;
+    }
+}
+
+/** Perpendicular and parallel baselines on a coarse radar grid.
+ *
+ * Baselines are evaluated on a RadarGridCube of heights x decimated azimuth lines
+ * x decimated range bins. Ground targets of the reference geometry are solved once
+ * with zero-Doppler rdr2geo and reused for any number of secondary orbits. For
+ * each secondary, the zero-Doppler time of every target is found by Newton
+ * iterations warm-started from the neighboring range node, so the secondary orbit
+ * is interpolated only once or twice per node. Values at full resolution are
+ * obtained by trilinear interpolation of the cube.
+ *
+ * The parallel baseline is the secondary minus reference slant range to the
+ * target. The perpendicular baseline is positive when the secondary lies on the
+ * side of the reference look vector given by (look x baseline) . velocity > 0. */
+class isce::geometry::BaselineGrid : public isce::geometry::RadarGridCube {
+
+    public:
+        /** Default constructor */
+        BaselineGrid() {}
+
+        /** Constructor from radar grid */
+        BaselineGrid(const isce::product::RadarGridParameters & radarGrid,
+                     const std::vector<double> & heights,
+                     size_t azimuthDecimation = 100,
+                     size_t rangeDecimation = 100);
+
+        /** Constructor from explicit azimuth and range sampling */
+        BaselineGrid(double azimuthStart, double azimuthSpacing, size_t length,
+                     double startingRange, double rangeSpacing, size_t width,
+                     const std::vector<double> & heights,
+                     size_t azimuthDecimation = 100,
+                     size_t rangeDecimation = 100);
+
+        /** Solve for ground targets of the reference geometry on the coarse grid.
+          * The orbit interpolation method is also used for secondary orbits. */
+        void computeReferenceGeometry(const isce::core::Orbit & orbit,
+                                      const isce::core::Ellipsoid & ellipsoid,
+                                      int lookSide,
+                                      isce::core::orbitInterpMethod orbitMethod =
+                                          isce::core::HERMITE_METHOD);
+
+        /** Compute baselines to a secondary orbit on the coarse grid */
+        void computeBaselines(const isce::core::Orbit & secondaryOrbit,
+                              double threshold = 1.0e-8,
+                              int maxIter = 20);
+
+        /** Perpendicular and parallel baselines at a (fractional) line, range bin and height */
+        inline void baselines(double line, double rbin, double height,
+                              double & bperp, double & bpar) const;
+
+        /** Perpendicular and parallel baselines for all range bins of a line */
+        void baselineLine(size_t line, double height, double * bperp, double * bpar) const;
+
+        /** Perpendicular and parallel baselines for all range bins of a line */
+        void baselineLine(size_t line, double height, std::valarray<double> & bperp,
+                          std::valarray<double> & bpar) const;
+
+        /** Orbit interpolation method for reference and secondary orbits */
+        inline isce::core::orbitInterpMethod orbitMethod() const { return _orbitMethod; }
+
+        /** Perpendicular baselines (height x coarse line x coarse range bin) */
+        inline isce::core::Cube<float> & perpendicularBaseline() { return _bperp; }
+        inline const isce::core::Cube<float> & perpendicularBaseline() const { return _bperp; }
+
+        /** Parallel baselines (height x coarse line x coarse range bin) */
+        inline isce::core::Cube<float> & parallelBaseline() { return _bpar; }
+        inline const isce::core::Cube<float> & parallelBaseline() const { return _bpar; }
+
+    private:
+        // Orbit interpolation method
+        isce::core::orbitInterpMethod _orbitMethod = isce::core::HERMITE_METHOD;
+
+        // Baselines on coarse grid
+        isce::core::Cube<float> _bperp;
+        isce::core::Cube<float> _bpar;
+};
+
+/** @param[in] line Line index (may be fractional)
+  * @param[in] rbin Range bin (may be fractional)
+  * @param[in] height Height above ellipsoid
+  * @param[out] bperp Perpendicular baseline
+  * @param[out] bpar Parallel baseline */
+inline void isce::geometry::BaselineGrid::
+baselines(double line, double rbin, double height, double & bperp, double & bpar) const {
+
+    // Position on the coarse grid
+    const double y = line / azimuthDecimation();
+    const double x = rbin / rangeDecimation();
+    const size_t row = std::min(static_cast<size_t>(std::max(y, 0.0)), coarseLength() - 2);
+    const size_t col = std::min(static_cast<size_t>(std::max(x, 0.0)), coarseWidth() - 2);
+    const double ty = y - row;
+    const double tx = x - col;
+
+    // Height bracket
+    size_t k;
+    double tz;
+    _heightIndex(height, k, tz);
+    const size_t k1 = std::min(k + 1, heights().size() - 1);
+
+    // Trilinear interpolation
+    bperp = 0.0;
+    bpar = 0.0;
+    const double wz[2] = {1.0 - tz, tz};
+    const size_t kk[2] = {k, k1};
+    for (int iz = 0; iz < 2; ++iz) {
+        const size_t s = kk[iz];
+        const double p = (1.0 - ty) * ((1.0 - tx) * _bperp(s, row, col) + tx * _bperp(s, row, col+1))
+                       + ty * ((1.0 - tx) * _bperp(s, row+1, col) + tx * _bperp(s, row+1, col+1));
+        const double q = (1.0 - ty) * ((1.0 - tx) * _bpar(s, row, col) + tx * _bpar(s, row, col+1))
+                       + ty * ((1.0 - tx) * _bpar(s, row+1, col) + tx * _bpar(s, row+1, col+1));
+        bperp += wz[iz] * p;
+        bpar += wz[iz] * q;
+    }
+}
+
+#endif
+
+// end of file
@@ -103,6 +103,45 @@ loadDEM(isce::io::Raster & demRaster, double minLon, double maxLon,
 
     // Indicate we have loaded a valid raster
     _haveRaster = true;
+
+    // Precompute gradients if requested. Only bilinear heights have slopes
+    // that are reproduced exactly by interpolating the post differences.
+    _haveGradients = false;
+    if (_computeGradients && _interpMethod == isce::core::BILINEAR_METHOD) {
+        _computeGradientGrids();
+    }
+}
+
+// Central difference gradients at DEM posts (one-sided at edges)
+void isce::geometry::DEMInterpolator::
+_computeGradientGrids() {
+
+    const size_t length = _dem.length();
+    const size_t width = _dem.width();
+    if (length < 2 || width < 2) {
+        return;
+    }
+    _dhdx.resize(length, width);
+    _dhdy.resize(length, width);
+
+    #pragma omp parallel for
+    for (size_t i = 0; i < length; ++i) {
+        const size_t iup = (i == 0) ? 0 : i - 1;
+        const size_t idown = (i == length - 1) ? i : i + 1;
+        const double scaley = 1.0 / ((idown - iup) * _deltay);
+        const float * hup = _dem.rowptr(iup);
+        const float * h = _dem.rowptr(i);
+        const float * hdown = _dem.rowptr(idown);
+        float * dhdx = _dhdx.rowptr(i);
+        float * dhdy = _dhdy.rowptr(i);
+        for (size_t j = 0; j < width; ++j) {
+            const size_t jleft = (j == 0) ? 0 : j - 1;
+            const size_t jright = (j == width - 1) ? j : j + 1;
+            dhdx[j] = (h[jright] - h[jleft]) / ((jright - jleft) * _deltax);
+            dhdy[j] = (hdown[j] - hup[j]) * scaley;
+        }
+    }
+    _haveGradients = true;
 }
 
 // Debugging output
@@ -214,4 +253,51 @@ interpolateXY(double x, double y) const {
     return _interp->interpolate(col, row, _dem);
 }
 
+/** @param[in] x X-coordinate of interpolation point.
+  * @param[in] y Y-coordinate of interpolation point.
+  * @param[out] dhdx Height gradient along X (height units per X unit).
+  * @param[out] dhdy Height gradient along Y (height units per Y unit).
+  *
+  * The gradient is the central difference of interpolated heights spaced
+  * one post apart. Gradient grids are only precomputed for bilinear DEMs,
+  * where a bilinear interpolation of the post differences in the same DEM cell
+  * gives the same result. Points whose neighbors fall outside the DEM subset
+  * always difference interpolated heights, as those neighbors take the
+  * reference height. */
+double isce::geometry::DEMInterpolator::
+interpolateXY(double x, double y, double & dhdx, double & dhdy) const {
+
+    // Compute the row and column for requested lat and lon
+    const double row = (y - _ystart) / _deltay;
+    const double col = (x - _xstart) / _deltax;
+    const int irow = int(std::floor(row));
+    const int icol = int(std::floor(col));
+
+    // Without precomputed gradients or near the edges, difference
+    // interpolated heights
+    if (!_haveGradients ||
+        irow < 3 || irow >= int(_dem.length() - 2) ||
+        icol < 3 || icol >= int(_dem.width() - 2)) {
+        dhdx = (interpolateXY(x + _deltax, y) - interpolateXY(x - _deltax, y))
+             / (2.0 * _deltax);
+        dhdy = (interpolateXY(x, y + _deltay) - interpolateXY(x, y - _deltay))
+             / (2.0 * _deltay);
+        return interpolateXY(x, y);
+    }
+
+    // Bilinear weights shared by both gradient grids
+    const double wy = row - irow;
+    const double wx = col - icol;
+    const double w00 = (1.0 - wy) * (1.0 - wx);
+    const double w01 = (1.0 - wy) * wx;
+    const double w10 = wy * (1.0 - wx);
+    const double w11 = wy * wx;
+    dhdx = w00 * _dhdx(irow, icol) + w01 * _dhdx(irow, icol + 1)
+         + w10 * _dhdx(irow + 1, icol) + w11 * _dhdx(irow + 1, icol + 1);
+    dhdy = w00 * _dhdy(irow, icol) + w01 * _dhdy(irow, icol + 1)
+         + w10 * _dhdy(irow + 1, icol) + w11 * _dhdy(irow + 1, icol + 1);
+
+    return _interp->interpolate(col, row, _dem);
+}
+
 // end of file
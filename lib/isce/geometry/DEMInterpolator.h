@@ -83,6 +83,8 @@ class isce::geometry::DEMInterpolator {
         double interpolateLonLat(double lon, double lat) const;
         /** Interpolate at native XY coordinates of DEM */
         double interpolateXY(double x, double y) const;
+        /** Interpolate height and its XY gradient at native XY coordinates of DEM */
+        double interpolateXY(double x, double y, double & dhdx, double & dhdy) const;
 
         /** Get starting X coordinate */
         double xStart() const { return _xstart; }
@@ -130,6 +132,20 @@ class isce::geometry::DEMInterpolator {
             return _interpMethod;
         }
 
+        /** Get flag for precomputing gradients when a DEM is loaded */
+        inline bool computeGradients() const { return _computeGradients; }
+        /** Set flag for precomputing gradients when a DEM is loaded.
+         * Only honored for bilinear interpolation; other methods always
+         * difference interpolated heights. */
+        inline void computeGradients(bool flag) { _computeGradients = flag; }
+
+        /** Flag indicating whether gradient grids are available */
+        inline bool haveGradients() const { return _haveGradients; }
+
+    private:
+        /** Central difference gradients of the loaded DEM subset */
+        void _computeGradientGrids();
+
     private:
         // Flag indicating whether we have access to a DEM raster
         bool _haveRaster;
@@ -148,6 +164,10 @@ class isce::geometry::DEMInterpolator {
         isce::core::Matrix<float> _dem;
         // Starting x/y for DEM subset and spacing
         double _xstart, _ystart, _deltax, _deltay;
+        // Gradients of DEM subset along x and y
+        bool _computeGradients = false;
+        bool _haveGradients = false;
+        isce::core::Matrix<float> _dhdx, _dhdy;
 };
 
 #endif
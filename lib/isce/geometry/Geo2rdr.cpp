@@ -75,28 +75,11 @@ geo2rdr(isce::io::Raster & topoRaster,
     // Initialize projection for topo results
     _projTopo = isce::core::createProj(topoRaster.getEPSG());
 
-    // Cache sensing start
-    double t0 = _radarGrid.sensingStart();
-    // Adjust for const azimuth shift
-    t0 -= (azshift - 0.5 * (_radarGrid.numberAzimuthLooks() - 1)) /
-           _radarGrid.prf();
-
-    // Cache starting range
-    double r0 = _radarGrid.startingRange();
-    // Adjust for constant range shift
-    r0 -= (rgshift - 0.5 * (_radarGrid.numberRangeLooks() - 1)) *
-           _radarGrid.rangePixelSpacing();
-
-    // Compute azimuth time extents
-    double dtaz = _radarGrid.numberAzimuthLooks() / _radarGrid.prf();
-    const double tend = t0 + ((_radarGrid.length() - 1) * dtaz);
+    // Radar grid extents adjusted for constant shifts
+    double t0, tend, dtaz, r0, rngend, dmrg;
+    radarExtents(azshift, rgshift, t0, tend, dtaz, r0, rngend, dmrg);
     const double tmid = 0.5 * (t0 + tend);
 
-    // Compute range extents
-    const double dmrg = _radarGrid.numberRangeLooks() *
-                        _radarGrid.rangePixelSpacing();
-    const double rngend = r0 + ((_radarGrid.width() - 1) * dmrg);
-
     // Print out extents
     _printExtents(info, t0, tend, dtaz, r0, rngend, dmrg, demWidth, demLength);
 
@@ -136,56 +119,32 @@ geo2rdr(isce::io::Raster & topoRaster,
              << _doppler.eval(tblock, rngend) << " "
              << pyre::journal::endl;
 
-        // Valarrays to hold input block from topo rasters
-        std::valarray<double> x(blockSize), y(blockSize), hgt(blockSize);
+        // Valarray to hold input block of pixel-interleaved x,y,h from topo raster
+        std::valarray<double> xyh(3 * blockSize);
         // Valarrays to hold block of geo2rdr results
         std::valarray<float> rgoff(blockSize), azoff(blockSize);
 
         // Read block of topo data
-        topoRaster.getBlock(x, 0, lineStart, demWidth, blockLength, 1);
-        topoRaster.getBlock(y, 0, lineStart, demWidth, blockLength, 2);
-        topoRaster.getBlock(hgt, 0, lineStart, demWidth, blockLength,3);
+        topoRaster.getBlock(xyh, 0, lineStart, demWidth, blockLength, {1, 2, 3},
+                            isce::io::BIP_LAYOUT);
+
+        // Convert topo XYZ to LLH
+        std::valarray<double> llh(3 * blockSize);
+        #pragma omp parallel for
+        for (size_t index = 0; index < blockSize; ++index) {
+            const Vec3 target = _projTopo->inverse(
+                Vec3{xyh[3*index], xyh[3*index + 1], xyh[3*index + 2]});
+            for (int i = 0; i < 3; ++i) {
+                llh[3*index + i] = target[i];
+            }
+        }
 
         // Loop over DEM lines in block
         for (size_t blockLine = 0; blockLine < blockLength; ++blockLine) {
-
-            // Global line index
-            const size_t line = lineStart + blockLine;
-
-            // Loop over DEM pixels
-            #pragma omp parallel for reduction(+:converged)
-            for (size_t pixel = 0; pixel < demWidth; ++pixel) {
-
-                // Convert topo XYZ to LLH
-                const size_t index = blockLine * demWidth + pixel;
-                Vec3 xyz{x[index], y[index], hgt[index]};
-                Vec3 llh = _projTopo->inverse(xyz);
-
-                // Perform geo->rdr iterations
-                double aztime, slantRange;
-                int geostat = isce::geometry::geo2rdr(
-                    llh, _ellipsoid, _orbit, _doppler,  aztime, slantRange,
-                    _radarGrid.wavelength(), _threshold, _numiter, 1.0e-8
-                );
-
-                // Check if solution is out of bounds
-                bool isOutside = false;
-                if ((aztime < t0) || (aztime > tend))
-                    isOutside = true;
-                if ((slantRange < r0) || (slantRange > rngend))
-                    isOutside = true;
-
-                // Save result if valid
-                if (!isOutside) {
-                    rgoff[index] = ((slantRange - r0) / dmrg) - float(pixel);
-                    azoff[index] = ((aztime - t0) / dtaz) - float(line);
-                    converged += geostat;
-                } else {
-                    rgoff[index] = NULL_VALUE;
-                    azoff[index] = NULL_VALUE;
-                }
-            } // end OMP for loop pixels in block
-        } // end for loop lines in block
+            const size_t offset = blockLine * demWidth;
+            converged += geo2rdrLine(&llh[3*offset], lineStart + blockLine, demWidth,
+                                     &rgoff[offset], &azoff[offset], azshift, rgshift);
+        }
 
         // Write block of data
         rgoffRaster.setBlock(rgoff, 0, lineStart, demWidth, blockLength);
@@ -199,6 +158,89 @@ geo2rdr(isce::io::Raster & topoRaster,
 
 }
 
+/** @param[in] llh Interleaved lon/lat/height (radians, meters) of targets on the line
+  * @param[in] line Line index of targets in the output offset grid
+  * @param[in] width Number of targets on the line
+  * @param[out] rgoff Range offsets for the line
+  * @param[out] azoff Azimuth offsets for the line
+  * @param[in] azshift Number of lines to shift by in azimuth
+  * @param[in] rgshift Number of pixels to shift by in range
+  * @returns Number of converged targets
+  *
+  * Offsets are defined as in geo2rdr(): the radar coordinates of each target minus
+  * its (line, pixel) position. Targets falling outside of the radar grid are set
+  * to NULL_VALUE. */
+size_t isce::geometry::Geo2rdr::
+geo2rdrLine(const double * llh, size_t line, size_t width, float * rgoff, float * azoff,
+            double azshift, double rgshift) const {
+
+    // Radar grid extents adjusted for constant shifts
+    double t0, tend, dtaz, r0, rngend, dmrg;
+    radarExtents(azshift, rgshift, t0, tend, dtaz, r0, rngend, dmrg);
+
+    // Loop over pixels
+    size_t converged = 0;
+    #pragma omp parallel for reduction(+:converged)
+    for (size_t pixel = 0; pixel < width; ++pixel) {
+
+        // Perform geo->rdr iterations
+        const Vec3 target{llh[3*pixel], llh[3*pixel+1], llh[3*pixel+2]};
+        double aztime, slantRange;
+        int geostat = isce::geometry::geo2rdr(
+            target, _ellipsoid, _orbit, _doppler,  aztime, slantRange,
+            _radarGrid.wavelength(), _threshold, _numiter, 1.0e-8
+        );
+
+        // Check if solution is out of bounds
+        bool isOutside = false;
+        if ((aztime < t0) || (aztime > tend))
+            isOutside = true;
+        if ((slantRange < r0) || (slantRange > rngend))
+            isOutside = true;
+
+        // Save result if valid
+        if (!isOutside) {
+            rgoff[pixel] = ((slantRange - r0) / dmrg) - float(pixel);
+            azoff[pixel] = ((aztime - t0) / dtaz) - float(line);
+            converged += geostat;
+        } else {
+            rgoff[pixel] = NULL_VALUE;
+            azoff[pixel] = NULL_VALUE;
+        }
+    }
+    return converged;
+}
+
+/** @param[in] azshift Number of lines to shift by in azimuth
+  * @param[in] rgshift Number of pixels to shift by in range
+  * @param[out] t0 Azimuth time of first line
+  * @param[out] tend Azimuth time of last line
+  * @param[out] dtaz Azimuth time between lines
+  * @param[out] r0 Slant range of first pixel
+  * @param[out] rngend Slant range of last pixel
+  * @param[out] dmrg Slant range between pixels */
+void isce::geometry::Geo2rdr::
+radarExtents(double azshift, double rgshift, double & t0, double & tend, double & dtaz,
+             double & r0, double & rngend, double & dmrg) const {
+
+    // Sensing start adjusted for const azimuth shift
+    t0 = _radarGrid.sensingStart()
+       - (azshift - 0.5 * (_radarGrid.numberAzimuthLooks() - 1)) / _radarGrid.prf();
+
+    // Starting range adjusted for constant range shift
+    r0 = _radarGrid.startingRange()
+       - (rgshift - 0.5 * (_radarGrid.numberRangeLooks() - 1))
+       * _radarGrid.rangePixelSpacing();
+
+    // Azimuth time extents
+    dtaz = _radarGrid.numberAzimuthLooks() / _radarGrid.prf();
+    tend = t0 + ((_radarGrid.length() - 1) * dtaz);
+
+    // Range extents
+    dmrg = _radarGrid.numberRangeLooks() * _radarGrid.rangePixelSpacing();
+    rngend = r0 + ((_radarGrid.width() - 1) * dmrg);
+}
+
 // Print extents and image sizes
 void isce::geometry::Geo2rdr::
 _printExtents(pyre::journal::info_t & info, double t0, double tend, double dtaz,
@@ -82,6 +82,16 @@ class isce::geometry::Geo2rdr {
                      const std::string & outdir,
                      double azshift=0.0, double rgshift=0.0);
 
+        /** Run geo2rdr on one line of target coordinates held in memory */
+        size_t geo2rdrLine(const double * llh, size_t line, size_t width,
+                           float * rgoff, float * azoff,
+                           double azshift=0.0, double rgshift=0.0) const;
+
+        /** Radar grid extents adjusted for constant shifts and looks */
+        void radarExtents(double azshift, double rgshift,
+                          double & t0, double & tend, double & dtaz,
+                          double & r0, double & rngend, double & dmrg) const;
+
         /** NoData Value*/
         const double NULL_VALUE = -1.0e6;
 
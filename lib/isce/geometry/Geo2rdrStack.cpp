@@ -0,0 +1,191 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#include <algorithm>
+#include <valarray>
+
+// pyre
+#include <pyre/journal.h>
+
+// isce::core
+#include <isce/core/Projections.h>
+
+// isce::except
+#include <isce/except/Error.h>
+
+// isce::geometry
+#include "geometry.h"
+#include "Geo2rdrStack.h"
+
+using isce::core::Vec3;
+using isce::io::Raster;
+
+/** @param[in] radarGrid RadarGridParameters of the secondary
+  * @param[in] orbit Orbit of the secondary
+  * @param[in] doppler LUT2d Doppler model of the secondary */
+void isce::geometry::Geo2rdrStack::
+addSecondary(const isce::product::RadarGridParameters & radarGrid,
+             const isce::core::Orbit & orbit,
+             const isce::core::LUT2d<double> & doppler) {
+    _secondaries.emplace_back(radarGrid, orbit, _ellipsoid, doppler);
+}
+
+/** @param[in] topoRaster outputs of topo - i.e, pixel-by-pixel x,y,h as bands
+  * @param[in] outdirs directory to write outputs to for each secondary
+  * @param[in] azshift Number of lines to shift by in azimuth
+  * @param[in] rgshift Number of pixels to shift by in range
+  *
+  * The offset file names in each directory are the ones used by Geo2rdr::geo2rdr
+  * <ul>
+  * <li>azimuth.off - Azimuth offset to be applied to secondary to align with topoRaster
+  * <li>range.off - Range offset to be applied to secondary to align with topoRaster
+  * </ul> */
+void isce::geometry::Geo2rdrStack::
+geo2rdr(Raster & topoRaster, const std::vector<std::string> & outdirs,
+        double azshift, double rgshift) {
+
+    if (outdirs.size() != _secondaries.size()) {
+        throw isce::except::LengthError(ISCE_SRCINFO(),
+            "Number of output directories must match number of secondaries");
+    }
+
+    // Create output rasters
+    std::vector<Raster> rgoffRasters, azoffRasters;
+    for (const std::string & outdir : outdirs) {
+        rgoffRasters.push_back(Raster(outdir + "/range.off", topoRaster.width(),
+            topoRaster.length(), 1, GDT_Float32, "ISCE"));
+        azoffRasters.push_back(Raster(outdir + "/azimuth.off", topoRaster.width(),
+            topoRaster.length(), 1, GDT_Float32, "ISCE"));
+    }
+
+    // Call main geo2rdr
+    geo2rdr(topoRaster, rgoffRasters, azoffRasters, azshift, rgshift);
+}
+
+/** @param[in] topoRaster outputs of topo - i.e, pixel-by-pixel x,y,h as bands
+  * @param[in] rgoffRasters range offset output for each secondary
+  * @param[in] azoffRasters azimuth offset output for each secondary
+  * @param[in] azshift Number of lines to shift by in azimuth
+  * @param[in] rgshift Number of pixels to shift by in range */
+void isce::geometry::Geo2rdrStack::
+geo2rdr(Raster & topoRaster, std::vector<Raster> & rgoffRasters,
+        std::vector<Raster> & azoffRasters, double azshift, double rgshift) {
+
+    // Check consistency of inputs
+    const size_t nsec = _secondaries.size();
+    if (nsec == 0) {
+        throw isce::except::LengthError(ISCE_SRCINFO(),
+            "Geo2rdrStack requires at least one secondary");
+    }
+    if ((rgoffRasters.size() != nsec) || (azoffRasters.size() != nsec)) {
+        throw isce::except::LengthError(ISCE_SRCINFO(),
+            "Number of offset rasters must match number of secondaries");
+    }
+
+    // Create reusable pyre::journal channels
+    pyre::journal::info_t info("isce.geometry.Geo2rdrStack");
+
+    // Cache the size of the DEM images
+    const size_t demWidth = topoRaster.width();
+    const size_t demLength = topoRaster.length();
+
+    // Initialize projection for topo results
+    isce::core::ProjectionBase * proj = isce::core::createProj(topoRaster.getEPSG());
+
+    // Radar grid extents of every secondary adjusted for constant shifts
+    std::vector<double> t0(nsec), tend(nsec), dtaz(nsec), r0(nsec), rngend(nsec), dmrg(nsec);
+    for (size_t s = 0; s < nsec; ++s) {
+        _secondaries[s].radarExtents(azshift, rgshift, t0[s], tend[s], dtaz[s],
+                                     r0[s], rngend[s], dmrg[s]);
+    }
+
+    // Offsets of all secondaries are held for a block; keep memory comparable to a
+    // single Geo2rdr run
+    const size_t linesPerBlock = std::max(std::min(demLength, _linesPerBlock / nsec),
+                                          (size_t) 1);
+    size_t nBlocks = demLength / linesPerBlock;
+    if ((demLength % linesPerBlock) != 0)
+        nBlocks += 1;
+
+    info << "Number of secondaries: " << nsec << pyre::journal::newline
+         << "Geocoded lines: " << demLength << pyre::journal::newline
+         << "Geocoded samples: " << demWidth << pyre::journal::newline
+         << "Lines per block: " << linesPerBlock << pyre::journal::endl;
+
+    // Loop over blocks
+    size_t converged = 0;
+    for (size_t block = 0; block < nBlocks; ++block) {
+
+        // Get block extents
+        const size_t lineStart = block * linesPerBlock;
+        const size_t blockLength = std::min(linesPerBlock, demLength - lineStart);
+        const size_t blockSize = blockLength * demWidth;
+
+        // Read block of topo data
+        std::valarray<double> xyh(3 * blockSize);
+        topoRaster.getBlock(xyh, 0, lineStart, demWidth, blockLength, {1, 2, 3},
+                            isce::io::BIP_LAYOUT);
+
+        // Convert topo XYZ to ECEF once for all secondaries
+        std::valarray<double> targets(3 * blockSize);
+        #pragma omp parallel for
+        for (size_t index = 0; index < blockSize; ++index) {
+            const Vec3 llh = proj->inverse(
+                Vec3{xyh[3*index], xyh[3*index + 1], xyh[3*index + 2]});
+            const Vec3 xyz = _ellipsoid.lonLatToXyz(llh);
+            for (int i = 0; i < 3; ++i) {
+                targets[3*index + i] = xyz[i];
+            }
+        }
+
+        // Valarrays to hold block of geo2rdr results for every secondary
+        std::vector<std::valarray<float>> rgoff(nsec, std::valarray<float>(blockSize));
+        std::vector<std::valarray<float>> azoff(nsec, std::valarray<float>(blockSize));
+
+        // Loop over (pixel, secondary) pairs; secondaries of a pixel are adjacent
+        #pragma omp parallel for reduction(+:converged)
+        for (size_t k = 0; k < blockSize * nsec; ++k) {
+
+            const size_t index = k / nsec;
+            const size_t s = k % nsec;
+            const size_t line = lineStart + index / demWidth;
+            const size_t pixel = index % demWidth;
+            const Geo2rdr & secondary = _secondaries[s];
+
+            // Perform geo->rdr iterations
+            const Vec3 target{targets[3*index], targets[3*index+1], targets[3*index+2]};
+            double aztime, slantRange;
+            int geostat = isce::geometry::geo2rdrXYZ(
+                target, secondary.orbit(), secondary.doppler(), aztime, slantRange,
+                secondary.radarGridParameters().wavelength(), _threshold, _numiter, 1.0e-8
+            );
+
+            // Save result if within the secondary radar grid
+            if ((aztime < t0[s]) || (aztime > tend[s]) ||
+                (slantRange < r0[s]) || (slantRange > rngend[s])) {
+                rgoff[s][index] = NULL_VALUE;
+                azoff[s][index] = NULL_VALUE;
+            } else {
+                rgoff[s][index] = ((slantRange - r0[s]) / dmrg[s]) - float(pixel);
+                azoff[s][index] = ((aztime - t0[s]) / dtaz[s]) - float(line);
+                converged += geostat;
+            }
+        }
+
+        // Write block of data for every secondary
+        for (size_t s = 0; s < nsec; ++s) {
+            rgoffRasters[s].setBlock(rgoff[s], 0, lineStart, demWidth, blockLength);
+            azoffRasters[s].setBlock(azoff[s], 0, lineStart, demWidth, blockLength);
+        }
+    }
+
+    // Print out convergence statistics
+    info << "Total convergence: " << converged << " out of "
+         << (demWidth * demLength * nsec) << pyre::journal::endl;
+
+    delete proj;
+}
+
+// end of file
@@ -0,0 +1,99 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#ifndef ISCE_GEOMETRY_GEO2RDRSTACK_H
+#define ISCE_GEOMETRY_GEO2RDRSTACK_H
+
+#include <string>
+#include <vector>
+
+// isce::core
+#include <isce/core/Ellipsoid.h>
+#include <isce/core/LUT2d.h>
+#include <isce/core/Orbit.h>
+
+// isce::io
+#include <isce/io/Raster.h>
+
+// isce::product
+#include <isce/product/RadarGridParameters.h>
+
+// isce::geometry
+#include "Geo2rdr.h"
+
+// Declaration
+namespace isce {
+    namespace geometry {
+        class Geo2rdrStack;
+    }
+}
+
+/** Transformer from map coordinates to the radar geometry of a stack of acquisitions.
+ *
+ * Each block of a topo raster is read once and its targets are converted to ECEF
+ * once; geo2rdr is then solved for every (target, secondary) pair. Offsets are
+ * defined as in Geo2rdr::geo2rdr and written as one range/azimuth pair per
+ * secondary. */
+class isce::geometry::Geo2rdrStack {
+
+    public:
+        /** Constructor from ellipsoid shared by all acquisitions */
+        Geo2rdrStack(const isce::core::Ellipsoid & ellipsoid) : _ellipsoid(ellipsoid) {}
+
+        /** Add a secondary acquisition */
+        void addSecondary(const isce::product::RadarGridParameters & radarGrid,
+                          const isce::core::Orbit & orbit,
+                          const isce::core::LUT2d<double> & doppler =
+                              isce::core::LUT2d<double>());
+
+        /** Run geo2rdr for all secondaries with externally created offset rasters */
+        void geo2rdr(isce::io::Raster & topoRaster,
+                     std::vector<isce::io::Raster> & rgoffRasters,
+                     std::vector<isce::io::Raster> & azoffRasters,
+                     double azshift = 0.0, double rgshift = 0.0);
+
+        /** Run geo2rdr for all secondaries with internally created offset rasters */
+        void geo2rdr(isce::io::Raster & topoRaster,
+                     const std::vector<std::string> & outdirs,
+                     double azshift = 0.0, double rgshift = 0.0);
+
+        /** Set convergence threshold */
+        inline void threshold(double t) { _threshold = t; }
+        /** Set number of Newton-Raphson iterations */
+        inline void numiter(int n) { _numiter = n; }
+        /** Set number of topo lines read per block for a single secondary */
+        inline void linesPerBlock(size_t n) { _linesPerBlock = n; }
+
+        /** Return the azimuth time convergence threshold used for processing */
+        inline double threshold() const { return _threshold; }
+        /** Return number of Newton-Raphson iterations used for processing */
+        inline int numiter() const { return _numiter; }
+        /** Return number of topo lines read per block for a single secondary */
+        inline size_t linesPerBlock() const { return _linesPerBlock; }
+
+        /** Number of secondary acquisitions */
+        inline size_t numSecondaries() const { return _secondaries.size(); }
+        /** Get geometry of a secondary acquisition */
+        inline const Geo2rdr & secondary(size_t i) const { return _secondaries[i]; }
+        /** Get Ellipsoid object used for processing */
+        inline const isce::core::Ellipsoid & ellipsoid() const { return _ellipsoid; }
+
+        /** NoData Value*/
+        const double NULL_VALUE = -1.0e6;
+
+    private:
+        // Shared ellipsoid and secondary geometries
+        isce::core::Ellipsoid _ellipsoid;
+        std::vector<Geo2rdr> _secondaries;
+
+        // Processing parameters
+        int _numiter = 50;
+        double _threshold = 1.0e-8;
+        size_t _linesPerBlock = 1000;
+};
+
+#endif
+
+// end of file
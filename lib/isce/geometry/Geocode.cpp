@@ -4,6 +4,11 @@
 // Author: Heresh Fattahi
 // Copyright 2019-
 
+#include <algorithm>
+#include <vector>
+
+#include <isce/except/Error.h>
+
 #include "Geocode.h"
 
 using isce::core::Vec3;
@@ -21,18 +26,30 @@ geocode(isce::io::Raster & inputRaster,
     // create projection based on _epsg code
     isce::core::ProjectionBase * proj = isce::core::createProj(_epsgOut);
 
-    // instantiate the DEMInterpolator 
-    isce::geometry::DEMInterpolator demInterp;
-
     // Compute number of blocks in the output geocoded grid
     size_t nBlocks = _geoGridLength / _linesPerBlock;
     if ((_geoGridLength % _linesPerBlock) != 0)
         nBlocks += 1;
 
-    std::cout << " nBlocks: " << nBlocks << std::endl;
+    // Tiles along X direction; full width by default
+    const size_t tileWidth = (_columnsPerBlock > 0) ?
+                             std::min(_columnsPerBlock, _geoGridWidth) : _geoGridWidth;
+    size_t nTilesX = _geoGridWidth / tileWidth;
+    if ((_geoGridWidth % tileWidth) != 0)
+        nTilesX += 1;
+
+    pyre::journal::info_t info("isce.geometry.Geocode");
+    info << pyre::journal::at(__HERE__)
+         << "Number of blocks: " << nBlocks << " x " << nTilesX << " tiles"
+         << pyre::journal::endl;
+
+    // Tiles of a row run in parallel with serial work inside each tile; a
+    // single full-width tile is parallelized over its pixels instead
+    const bool parallelTiles = nTilesX > 1;
+
     //loop over the blocks of the geocoded Grid
     for (size_t block = 0; block < nBlocks; ++block) {
-        std::cout << "block : " << block << std::endl;
+        info << "Processing block: " << block << pyre::journal::endl;
         // Get block extents (of the geocoded grid)
         size_t lineStart, geoBlockLength;
         lineStart = block * _linesPerBlock;
@@ -41,113 +58,395 @@ geocode(isce::io::Raster & inputRaster,
         } else {
             geoBlockLength = _linesPerBlock;
         }
-        size_t blockSize = geoBlockLength * _geoGridWidth;
 
-        //First and last line of the data block in radar coordinates
-        int azimuthFirstLine, azimuthLastLine;
+        // Geocode the tiles of this row; each tile gets its own DEM and
+        // radar windows
+        #pragma omp parallel for schedule(dynamic) if (parallelTiles)
+        for (size_t tile = 0; tile < nTilesX; ++tile) {
+            const size_t pixelStart = tile * tileWidth;
+            const size_t geoBlockWidth = std::min(tileWidth, _geoGridWidth - pixelStart);
+
+            // load the DEM covering this tile
+            isce::geometry::DEMInterpolator demInterp;
+            #pragma omp critical(geocodeRasterIO)
+            _loadDEM(demRaster, demInterp, proj,
+                     lineStart, geoBlockLength, pixelStart, geoBlockWidth,
+                     _demBlockMargin);
+
+            _geocodeBlock(inputRaster, outputRaster, demInterp, proj, nbands,
+                          lineStart, geoBlockLength, pixelStart, geoBlockWidth,
+                          !parallelTiles);
+        }
+    } // end loop over block of output grid
 
-        //First and last pixel of the data block in radar coordinates
-        int rangeFirstPixel, rangeLastPixel;
+    outputRaster.setGeoTransform(_geoTrans);
+    outputRaster.setEPSG(_epsgOut);
+}
 
-        // load a block of DEM for the current geocoded grid
-        _loadDEM(demRaster, demInterp, proj,
-                lineStart, geoBlockLength, _geoGridWidth, 
-                _demBlockMargin);
-
-        //Given the current block on geocoded grid,
-        //compute the bounding box of a block of data in the radar image.
-        //This block of data will be used to interpolate the
-        //values to the geocoded block
-        _computeRangeAzimuthBoundingBox(lineStart, 
-                        geoBlockLength, _geoGridWidth,
-                        _radarBlockMargin, demInterp, proj,
-                        azimuthFirstLine, azimuthLastLine,
-                        rangeFirstPixel, rangeLastPixel);
-
-        // shape of the required block of data in the radar coordinates
-        size_t rdrBlockLength = azimuthLastLine - azimuthFirstLine + 1;
-        size_t rdrBlockWidth = rangeLastPixel - rangeFirstPixel + 1;
-
-        // X and Y indices (in the radar coordinates) for the 
-        // geocoded pixels (after geo2rdr computation)
-        std::valarray<double> radarX(blockSize);
-    	std::valarray<double> radarY(blockSize);
-
-        // Loop over lines of the output grid
-        for (size_t blockLine = 0; blockLine < geoBlockLength; ++blockLine) {
-            // Global line index
-            const size_t line = lineStart + blockLine;
-           
-            // y coordinate in the out put grid
-            double y = _geoGridStartY + _geoGridSpacingY*line;
-
-            // Loop over geocoded grid pixels
-            #pragma omp parallel for
-            for (size_t pixel = 0; pixel < _geoGridWidth; ++pixel) {
-                
-                // x in the output geocoded Grid
-                double x = _geoGridStartX + _geoGridSpacingX*pixel;
-
-                // Consistency check
-                
-                // compute the azimuth time and slant range for the 
-                // x,y coordinates in the output grid
-                double aztime, srange;
-                _geo2rdr(x, y, aztime, srange, demInterp, proj);
-
-                // get the row and column index in the radar grid
-                double rdrX, rdrY;
-                rdrY = (aztime - _radarGrid.sensingStart()) *
-                       (_radarGrid.prf() / _radarGrid.numberAzimuthLooks());
-		
-                rdrX = (srange - _radarGrid.startingRange()) /
-                       (_radarGrid.numberRangeLooks() * _radarGrid.rangePixelSpacing());	
-
-                // adjust the row and column indicies for the current block, 
-                // i.e., moving the origin to the top-left of this radar block.
-                rdrY -= azimuthFirstLine;
-                rdrX -= rangeFirstPixel;
-                
-                //store the adjusted X and Y indices 
-                radarX[blockLine*_geoGridWidth + pixel] = rdrX;
-                radarY[blockLine*_geoGridWidth + pixel] = rdrY;
-
-            } // end loop over pixels of output grid 
-        } // end loops over lines of output grid
-
-        // define the matrix based on the rasterbands data type
-        isce::core::Matrix<T> rdrDataBlock(rdrBlockLength, rdrBlockWidth);        
-        isce::core::Matrix<T> geoDataBlock(geoBlockLength, _geoGridWidth);
-
-        // fill both matrices with zero
-        rdrDataBlock.zeros();
-        geoDataBlock.zeros();
-         
-        //for each band in the input:
-        for (size_t band = 0; band < nbands; ++band){
+template<class T>
+void isce::geometry::Geocode<T>::
+_geocodeBlock(isce::io::Raster & inputRaster,
+              isce::io::Raster & outputRaster,
+              isce::geometry::DEMInterpolator & demInterp,
+              isce::core::ProjectionBase * proj,
+              size_t nbands,
+              size_t lineStart, size_t geoBlockLength,
+              size_t pixelStart, size_t geoBlockWidth,
+              bool parallel)
+{
+    size_t blockSize = geoBlockLength * geoBlockWidth;
+
+    //First and last line of the data block in radar coordinates
+    int azimuthFirstLine, azimuthLastLine;
+
+    //First and last pixel of the data block in radar coordinates
+    int rangeFirstPixel, rangeLastPixel;
+
+    //Given the current block on geocoded grid,
+    //compute the bounding box of a block of data in the radar image.
+    //This block of data will be used to interpolate the
+    //values to the geocoded block
+    _computeRangeAzimuthBoundingBox(lineStart, geoBlockLength,
+                    pixelStart, geoBlockWidth,
+                    _radarBlockMargin, demInterp, proj,
+                    azimuthFirstLine, azimuthLastLine,
+                    rangeFirstPixel, rangeLastPixel);
+
+    // output block in geocoded grid
+    isce::core::Matrix<T> geoDataBlock(geoBlockLength, geoBlockWidth);
+    geoDataBlock.zeros();
+
+    // the block does not overlap the radar grid; fill with zeros
+    if (azimuthLastLine < azimuthFirstLine || rangeLastPixel < rangeFirstPixel) {
+        for (size_t band = 0; band < nbands; ++band) {
+            #pragma omp critical(geocodeRasterIO)
+            outputRaster.setBlock(geoDataBlock.data(), pixelStart, lineStart,
+                                  geoBlockWidth, geoBlockLength, band+1);
+        }
+        return;
+    }
 
-            std::cout << "band: " << band << std::endl;
-            // get a block of data
-            std::cout << "get data block " << std::endl;
+    // shape of the required block of data in the radar coordinates
+    size_t rdrBlockLength = azimuthLastLine - azimuthFirstLine + 1;
+    size_t rdrBlockWidth = rangeLastPixel - rangeFirstPixel + 1;
+
+    // X and Y indices (in the radar coordinates) for the 
+    // geocoded pixels (after geo2rdr computation)
+    std::valarray<double> radarX(blockSize);
+    std::valarray<double> radarY(blockSize);
+
+    // Loop over lines of the output grid
+    for (size_t blockLine = 0; blockLine < geoBlockLength; ++blockLine) {
+        // Global line index
+        const size_t line = lineStart + blockLine;
+       
+        // y coordinate in the out put grid
+        double y = _geoGridStartY + _geoGridSpacingY*line;
+
+        // Loop over geocoded grid pixels
+        #pragma omp parallel for if (parallel)
+        for (size_t blockPixel = 0; blockPixel < geoBlockWidth; ++blockPixel) {
+            
+            // x in the output geocoded Grid
+            const size_t pixel = pixelStart + blockPixel;
+            double x = _geoGridStartX + _geoGridSpacingX*pixel;
+
+            // compute the azimuth time and slant range for the 
+            // x,y coordinates in the output grid
+            double aztime, srange;
+            _geo2rdr(x, y, aztime, srange, demInterp, proj);
+
+            // get the row and column index in the radar grid
+            double rdrX, rdrY;
+            rdrY = (aztime - _radarGrid.sensingStart()) *
+                   (_radarGrid.prf() / _radarGrid.numberAzimuthLooks());
+    
+            rdrX = (srange - _radarGrid.startingRange()) /
+                   (_radarGrid.numberRangeLooks() * _radarGrid.rangePixelSpacing());	
+
+            // adjust the row and column indicies for the current block, 
+            // i.e., moving the origin to the top-left of this radar block.
+            rdrY -= azimuthFirstLine;
+            rdrX -= rangeFirstPixel;
+            
+            //store the adjusted X and Y indices 
+            radarX[blockLine*geoBlockWidth + blockPixel] = rdrX;
+            radarY[blockLine*geoBlockWidth + blockPixel] = rdrY;
+
+        } // end loop over pixels of output grid 
+    } // end loops over lines of output grid
+
+    // interpolate all bands to the geocoded block
+    _geocodeBands(inputRaster, outputRaster, radarX, radarY,
+                  azimuthFirstLine, rangeFirstPixel, rdrBlockLength, rdrBlockWidth,
+                  lineStart, pixelStart, geoDataBlock, parallel);
+}
+
+template<class T>
+void isce::geometry::Geocode<T>::
+_geocodeBands(isce::io::Raster & inputRaster,
+              isce::io::Raster & outputRaster,
+              std::valarray<double> & radarX, std::valarray<double> & radarY,
+              int azimuthFirstLine, int rangeFirstPixel,
+              size_t rdrBlockLength, size_t rdrBlockWidth,
+              size_t lineStart, size_t pixelStart,
+              isce::core::Matrix<T> & geoDataBlock,
+              bool parallel)
+{
+    // define the matrix based on the rasterbands data type
+    isce::core::Matrix<T> rdrDataBlock(rdrBlockLength, rdrBlockWidth);        
+    rdrDataBlock.zeros();
+
+    // Multi-band rasters with a separable interpolator share weights across bands
+    const size_t nbands = inputRaster.numBands();
+    const int taps = _interp->taps();
+    if (nbands > 1 && taps > 0 && taps <= MAX_INTERP_TAPS) {
+
+        // Band-interleaved radar block
+        const size_t rdrSize = rdrBlockLength * rdrBlockWidth;
+        std::valarray<T> rdrBands(nbands * rdrSize);
+        for (size_t band = 0; band < nbands; ++band) {
+            #pragma omp critical(geocodeRasterIO)
             inputRaster.getBlock(rdrDataBlock.data(),
                                 rangeFirstPixel, azimuthFirstLine,
                                 rdrBlockWidth, rdrBlockLength, band+1);
+            const T * rdrData = rdrDataBlock.data();
+            for (size_t k = 0; k < rdrSize; ++k) {
+                rdrBands[k * nbands + band] = rdrData[k];
+            }
+        }
 
-            // interpolate the data in radar grid to the geocoded grid
-            std::cout << "interpolate " << std::endl;
-            _interpolate(rdrDataBlock, geoDataBlock, radarX, radarY, 
-                                rdrBlockWidth, rdrBlockLength);
+        // Band-interleaved geocoded block
+        const size_t geoSize = geoDataBlock.length() * geoDataBlock.width();
+        std::valarray<T> geoBands(T(0), nbands * geoSize);
+        _interpolateBands(rdrBands, geoBands, nbands, radarX, radarY,
+                          geoDataBlock.width(), geoDataBlock.length(),
+                          rdrBlockWidth, rdrBlockLength, parallel);
+
+        // set output
+        for (size_t band = 0; band < nbands; ++band) {
+            T * geoData = geoDataBlock.data();
+            for (size_t k = 0; k < geoSize; ++k) {
+                geoData[k] = geoBands[k * nbands + band];
+            }
+            #pragma omp critical(geocodeRasterIO)
+            outputRaster.setBlock(geoDataBlock.data(), pixelStart, lineStart,
+                                geoDataBlock.width(), geoDataBlock.length(), band+1);
+        }
+        return;
+    }
+     
+    //for each band in the input:
+    for (size_t band = 0; band < inputRaster.numBands(); ++band){
+
+        // get a block of data
+        #pragma omp critical(geocodeRasterIO)
+        inputRaster.getBlock(rdrDataBlock.data(),
+                            rangeFirstPixel, azimuthFirstLine,
+                            rdrBlockWidth, rdrBlockLength, band+1);
+
+        // interpolate the data in radar grid to the geocoded grid
+        geoDataBlock.zeros();
+        _interpolate(rdrDataBlock, geoDataBlock, radarX, radarY, 
+                            rdrBlockWidth, rdrBlockLength, parallel);
+
+        // set output
+        #pragma omp critical(geocodeRasterIO)
+        outputRaster.setBlock(geoDataBlock.data(), pixelStart, lineStart, 
+                            geoDataBlock.width(), geoDataBlock.length(), band+1);
+    }
+}
+
+template<class T>
+void isce::geometry::Geocode<T>::
+computeLookupTable(isce::io::Raster & demRaster,
+                   isce::geometry::GeocodeLookupTable & lookupTable,
+                   size_t decimation)
+{
+    // create projection based on _epsg code
+    isce::core::ProjectionBase * proj = isce::core::createProj(_epsgOut);
+
+    // lookup table spanning the geocoded grid
+    lookupTable = isce::geometry::GeocodeLookupTable(_geoTrans[0], _geoTrans[3],
+                        _geoGridSpacingX, _geoGridSpacingY,
+                        _geoGridWidth, _geoGridLength, _epsgOut, decimation);
+    decimation = lookupTable.decimation();
+    const size_t nrows = lookupTable.coarseLength();
+    const size_t ncols = lookupTable.coarseWidth();
+
+    // Cache the multilooked radar grid spacing
+    const double dtaz = _radarGrid.numberAzimuthLooks() / _radarGrid.prf();
+    const double dtrg = _radarGrid.numberRangeLooks() * _radarGrid.rangePixelSpacing();
+
+    // instantiate the DEMInterpolator 
+    isce::geometry::DEMInterpolator demInterp;
 
-            // set output
-            std::cout << "set output " << std::endl;
-            outputRaster.setBlock(geoDataBlock.data(), 0, lineStart, 
-                                _geoGridWidth, geoBlockLength, band+1);
+    // loop over blocks of lookup table rows
+    const size_t rowsPerBlock = std::max(_linesPerBlock / decimation, (size_t) 1);
+    for (size_t rowStart = 0; rowStart < nrows; rowStart += rowsPerBlock) {
+        const size_t rowEnd = std::min(rowStart + rowsPerBlock, nrows);
+
+        // load a block of DEM covering the nodes of these rows
+        _loadDEM(demRaster, demInterp, proj,
+                 rowStart * decimation, (rowEnd - 1 - rowStart) * decimation + 1,
+                 0, (ncols - 1) * decimation + 1, _demBlockMargin);
+
+        #pragma omp parallel for collapse(2)
+        for (size_t row = rowStart; row < rowEnd; ++row) {
+            for (size_t col = 0; col < ncols; ++col) {
+
+                // compute the azimuth time and slant range of the node
+                double aztime, srange;
+                _geo2rdr(lookupTable.coarseX(col), lookupTable.coarseY(row),
+                         aztime, srange, demInterp, proj);
+
+                // no valid solution; keep NaN
+                if (srange <= 0.0)
+                    continue;
+
+                // store the row and column index in the radar grid
+                lookupTable.radarLine()(row, col) = (aztime - _radarGrid.sensingStart()) / dtaz;
+                lookupTable.radarPixel()(row, col) = (srange - _radarGrid.startingRange()) / dtrg;
+            }
         }
-        // set output block of data
-    } // end loop over block of output grid
+    }
+}
 
-    outputRaster.setGeoTransform(_geoTrans);
-    outputRaster.setEPSG(_epsgOut);
+template<class T>
+void isce::geometry::Geocode<T>::
+geocode(isce::io::Raster & inputRaster,
+        isce::io::Raster & outputRaster,
+        const isce::geometry::GeocodeLookupTable & lookupTable)
+{
+    std::vector<isce::io::Raster> inputRasters{inputRaster};
+    std::vector<isce::io::Raster> outputRasters{outputRaster};
+    geocode(inputRasters, outputRasters, lookupTable);
+}
+
+template<class T>
+void isce::geometry::Geocode<T>::
+geocode(std::vector<isce::io::Raster> & inputRasters,
+        std::vector<isce::io::Raster> & outputRasters,
+        const isce::geometry::GeocodeLookupTable & lookupTable)
+{
+    if (inputRasters.size() != outputRasters.size()) {
+        throw isce::except::LengthError(ISCE_SRCINFO(),
+            "number of input and output rasters must match");
+    }
+
+    const size_t geoGridLength = lookupTable.length();
+    const size_t geoGridWidth = lookupTable.width();
+
+    // Compute number of blocks in the output geocoded grid
+    size_t nBlocks = geoGridLength / _linesPerBlock;
+    if ((geoGridLength % _linesPerBlock) != 0)
+        nBlocks += 1;
+
+    // Tiles along X direction; full width by default
+    const size_t tileWidth = (_columnsPerBlock > 0) ?
+                             std::min(_columnsPerBlock, geoGridWidth) : geoGridWidth;
+    size_t nTilesX = geoGridWidth / tileWidth;
+    if ((geoGridWidth % tileWidth) != 0)
+        nTilesX += 1;
+
+    // Tiles of a row run in parallel with serial work inside each tile; a
+    // single full-width tile is parallelized over its pixels instead
+    const bool parallelTiles = nTilesX > 1;
+
+    //loop over the blocks of the geocoded Grid
+    for (size_t block = 0; block < nBlocks; ++block) {
+
+        // Get block extents (of the geocoded grid)
+        const size_t lineStart = block * _linesPerBlock;
+        const size_t geoBlockLength = std::min(_linesPerBlock, geoGridLength - lineStart);
+
+        #pragma omp parallel for schedule(dynamic) if (parallelTiles)
+        for (size_t tile = 0; tile < nTilesX; ++tile) {
+            const size_t pixelStart = tile * tileWidth;
+            const size_t geoBlockWidth = std::min(tileWidth, geoGridWidth - pixelStart);
+            _geocodeBlock(inputRasters, outputRasters, lookupTable,
+                          lineStart, geoBlockLength, pixelStart, geoBlockWidth,
+                          !parallelTiles);
+        }
+    }
+
+    // geotransform and projection of the outputs
+    double geoTrans[6];
+    lookupTable.geoTransform(geoTrans);
+    for (auto & outputRaster : outputRasters) {
+        outputRaster.setGeoTransform(geoTrans);
+        outputRaster.setEPSG(lookupTable.epsg());
+    }
+}
+
+template<class T>
+void isce::geometry::Geocode<T>::
+_geocodeBlock(std::vector<isce::io::Raster> & inputRasters,
+              std::vector<isce::io::Raster> & outputRasters,
+              const isce::geometry::GeocodeLookupTable & lookupTable,
+              size_t lineStart, size_t geoBlockLength,
+              size_t pixelStart, size_t geoBlockWidth,
+              bool parallel)
+{
+    // Cache the multilooked radar grid length and width
+    const int rgLength = _radarGrid.length() / _radarGrid.numberAzimuthLooks();
+    const int rgWidth = _radarGrid.width() / _radarGrid.numberRangeLooks();
+
+    // output block in geocoded grid
+    isce::core::Matrix<T> geoDataBlock(geoBlockLength, geoBlockWidth);
+    geoDataBlock.zeros();
+
+    // radar bounding box of the block from the lookup table
+    double firstLine, lastLine, firstPixel, lastPixel;
+    const bool valid = lookupTable.radarBoundingBox(lineStart, geoBlockLength,
+                            pixelStart, geoBlockWidth,
+                            firstLine, lastLine, firstPixel, lastPixel);
+    int azimuthFirstLine = 0, azimuthLastLine = -1;
+    int rangeFirstPixel = 0, rangeLastPixel = -1;
+    if (valid) {
+        // extending the radar bounding box by the extra margin and
+        // making sure it is inside the existing radar grid
+        azimuthFirstLine = std::max(
+            static_cast<int>(std::floor(std::max(firstLine, -1.0e6))) - _radarBlockMargin, 0);
+        azimuthLastLine = std::min(
+            static_cast<int>(std::ceil(std::min(lastLine, 1.0e9))) + _radarBlockMargin,
+            rgLength - 1);
+        rangeFirstPixel = std::max(
+            static_cast<int>(std::floor(std::max(firstPixel, -1.0e6))) - _radarBlockMargin, 0);
+        rangeLastPixel = std::min(
+            static_cast<int>(std::ceil(std::min(lastPixel, 1.0e9))) + _radarBlockMargin,
+            rgWidth - 1);
+    }
+
+    // the block does not overlap the radar grid; fill with zeros
+    if (azimuthLastLine < azimuthFirstLine || rangeLastPixel < rangeFirstPixel) {
+        for (size_t k = 0; k < outputRasters.size(); ++k) {
+            for (size_t band = 0; band < inputRasters[k].numBands(); ++band) {
+                #pragma omp critical(geocodeRasterIO)
+                outputRasters[k].setBlock(geoDataBlock.data(), pixelStart, lineStart,
+                                          geoBlockWidth, geoBlockLength, band+1);
+            }
+        }
+        return;
+    }
+
+    // shape of the required block of data in the radar coordinates
+    const size_t rdrBlockLength = azimuthLastLine - azimuthFirstLine + 1;
+    const size_t rdrBlockWidth = rangeLastPixel - rangeFirstPixel + 1;
+
+    // radar coordinates of the geocoded pixels relative to the radar block
+    std::valarray<double> radarX, radarY;
+    lookupTable.radarCoordinates(lineStart, geoBlockLength, pixelStart, geoBlockWidth,
+                                 radarY, radarX);
+    radarY -= azimuthFirstLine;
+    radarX -= rangeFirstPixel;
+
+    // geocode every band of every raster with the same coordinates
+    for (size_t k = 0; k < inputRasters.size(); ++k) {
+        _geocodeBands(inputRasters[k], outputRasters[k], radarX, radarY,
+                      azimuthFirstLine, rangeFirstPixel, rdrBlockLength, rdrBlockWidth,
+                      lineStart, pixelStart, geoDataBlock, parallel);
+    }
 }
 
 template<class T>
@@ -155,14 +454,14 @@ void isce::geometry::Geocode<T>::
 _interpolate(isce::core::Matrix<T>& rdrDataBlock, 
             isce::core::Matrix<T>& geoDataBlock,
             std::valarray<double>& radarX, std::valarray<double>& radarY, 
-            int radarBlockWidth, int radarBlockLength)
+            int radarBlockWidth, int radarBlockLength, bool parallel)
 {
 
     size_t length = geoDataBlock.length();
     size_t width = geoDataBlock.width();
     double extraMargin = 4.0;
 
-    #pragma omp parallel for
+    #pragma omp parallel for if (parallel)
     for (size_t kk = 0; kk < length*width; ++kk) {
         
         size_t i = kk / width;
@@ -181,19 +480,81 @@ _interpolate(isce::core::Matrix<T>& rdrDataBlock,
     }
 }
 
+/** @param[in] rdrBands Band-interleaved radar block
+  * @param[out] geoBands Band-interleaved geocoded block
+  * @param[in] nbands Number of bands
+  * @param[in] radarX Radar pixel (relative to block) of each geocoded pixel
+  * @param[in] radarY Radar line (relative to block) of each geocoded pixel
+  *
+  * Interpolation weights and footprint are computed once per geocoded pixel and
+  * applied to all bands. */
+template<class T>
+void isce::geometry::Geocode<T>::
+_interpolateBands(const std::valarray<T> & rdrBands,
+                  std::valarray<T> & geoBands, size_t nbands,
+                  std::valarray<double>& radarX, std::valarray<double>& radarY,
+                  size_t geoBlockWidth, size_t geoBlockLength,
+                  int radarBlockWidth, int radarBlockLength, bool parallel)
+{
+    using promote_t = typename isce::core::double_promote<T>::type;
+
+    const size_t length = geoBlockLength;
+    const size_t width = geoBlockWidth;
+    const int taps = _interp->taps();
+    double extraMargin = 4.0;
+
+    #pragma omp parallel if (parallel)
+    {
+    // Per-thread weights and accumulators
+    int ix[MAX_INTERP_TAPS], iy[MAX_INTERP_TAPS];
+    double wx[MAX_INTERP_TAPS], wy[MAX_INTERP_TAPS];
+    std::vector<promote_t> acc(nbands);
+
+    #pragma omp for
+    for (size_t kk = 0; kk < length*width; ++kk) {
+
+        const double x = radarX[kk];
+        const double y = radarY[kk];
+        if (!(x >= extraMargin && y >= extraMargin &&
+              x < (radarBlockWidth - extraMargin) &&
+              y < (radarBlockLength - extraMargin))) {
+            continue;
+        }
+
+        _interp->weights(x, radarBlockWidth, ix, wx);
+        _interp->weights(y, radarBlockLength, iy, wy);
+
+        std::fill(acc.begin(), acc.end(), promote_t(0));
+        for (int ii = 0; ii < taps; ++ii) {
+            for (int jj = 0; jj < taps; ++jj) {
+                const double w = wy[ii] * wx[jj];
+                const size_t offset = (static_cast<size_t>(iy[ii]) * radarBlockWidth
+                                       + ix[jj]) * nbands;
+                for (size_t band = 0; band < nbands; ++band) {
+                    acc[band] += w * static_cast<promote_t>(rdrBands[offset + band]);
+                }
+            }
+        }
+        for (size_t band = 0; band < nbands; ++band) {
+            geoBands[kk * nbands + band] = static_cast<T>(acc[band]);
+        }
+    }
+    } // end omp parallel
+}
+
 template<class T>
 void isce::geometry::Geocode<T>::
 _loadDEM(isce::io::Raster demRaster,
         isce::geometry::DEMInterpolator & demInterp,
         isce::core::ProjectionBase * proj, 
         int lineStart, int blockLength, 
-        int blockWidth, double demMargin)
+        int pixelStart, int blockWidth, double demMargin)
 {
     // convert the corner of the current geocoded grid to lon lat
     double maxY = _geoGridStartY + _geoGridSpacingY*lineStart;
     double minY = _geoGridStartY + _geoGridSpacingY*(lineStart + blockLength - 1);
-    double minX = _geoGridStartX;
-    double maxX = _geoGridStartX + _geoGridSpacingX*(blockWidth - 1);
+    double minX = _geoGridStartX + _geoGridSpacingX*pixelStart;
+    double maxX = _geoGridStartX + _geoGridSpacingX*(pixelStart + blockWidth - 1);
 
     // top left corner of the box
     Vec3 xyz { minX, maxY, 0. };
@@ -223,8 +584,12 @@ _loadDEM(isce::io::Raster demRaster,
     demInterp.loadDEM(demRaster, minLon, maxLon, minLat, maxLat,
                                     demRaster.getEPSG());
 
-    if (demInterp.width() == 0 || demInterp.length() == 0)
-        std::cout << "warning there are not enough DEM coverage in the bounding box. " << std::endl;
+    if (demInterp.width() == 0 || demInterp.length() == 0) {
+        pyre::journal::warning_t warning("isce.geometry.Geocode");
+        warning << pyre::journal::at(__HERE__)
+                << "not enough DEM coverage in the bounding box"
+                << pyre::journal::endl;
+    }
 
     // declare the dem interpolator
     demInterp.declare();
@@ -232,7 +597,8 @@ _loadDEM(isce::io::Raster demRaster,
 
 template<class T>
 void isce::geometry::Geocode<T>::
-_computeRangeAzimuthBoundingBox(int lineStart, int blockLength, int blockWidth,
+_computeRangeAzimuthBoundingBox(int lineStart, int blockLength,
+                        int pixelStart, int blockWidth,
                         int margin, isce::geometry::DEMInterpolator & demInterp,
                         isce::core::ProjectionBase * proj,
                         int & azimuthFirstLine, int & azimuthLastLine,
@@ -255,21 +621,25 @@ _computeRangeAzimuthBoundingBox(int lineStart, int blockLength, int blockWidth,
     const double dtaz = _radarGrid.numberAzimuthLooks() / _radarGrid.prf();
     const double dtrg = _radarGrid.numberRangeLooks() * _radarGrid.rangePixelSpacing();
 
+    // first and last X coordinates of the block
+    const double firstX = _geoGridStartX + _geoGridSpacingX*pixelStart;
+    const double lastX = _geoGridStartX + _geoGridSpacingX*(pixelStart + blockWidth - 1);
+
     //top left corener on ground
     Y[0] = _geoGridStartY + _geoGridSpacingY*lineStart;
-    X[0] = _geoGridStartX;
+    X[0] = firstX;
 
     //top right corener on ground
     Y[1] = _geoGridStartY + _geoGridSpacingY*lineStart;
-    X[1] = _geoGridStartX + _geoGridSpacingX*(blockWidth - 1);
+    X[1] = lastX;
 
     //bottom left corener on ground 
     Y[2] = _geoGridStartY + _geoGridSpacingY*(lineStart + blockLength - 1);
-    X[2] = _geoGridStartX;
+    X[2] = firstX;
     
     //bottom right corener on ground
     Y[3] = _geoGridStartY + _geoGridSpacingY*(lineStart + blockLength - 1);
-    X[3] = _geoGridStartX + _geoGridSpacingX*(blockWidth - 1);
+    X[3] = lastX;
 
     // compute geo2rdr for the 4 corners
     for (size_t i = 0; i<4; ++i){
@@ -30,6 +30,7 @@
 // isce::geometry
 #include "geometry.h"
 #include "DEMInterpolator.h"
+#include "GeocodeLookupTable.h"
 
 // Declaration
 namespace isce {
@@ -59,6 +60,21 @@ class isce::geometry::Geocode {
                 isce::io::Raster & output,
                 isce::io::Raster & demRaster);
 
+        /** Compute geo to radar lookup table for the output geocoded grid */
+        void computeLookupTable(isce::io::Raster & demRaster,
+                isce::geometry::GeocodeLookupTable & lookupTable,
+                size_t decimation = 1);
+
+        /** Geocode a raster with a precomputed lookup table */
+        void geocode(isce::io::Raster & input,
+                isce::io::Raster & output,
+                const isce::geometry::GeocodeLookupTable & lookupTable);
+
+        /** Geocode several rasters in one pass with a precomputed lookup table */
+        void geocode(std::vector<isce::io::Raster> & inputs,
+                std::vector<isce::io::Raster> & outputs,
+                const isce::geometry::GeocodeLookupTable & lookupTable);
+
         /** Set the output geocoded grid*/
         inline void geoGrid(double geoGridStartX, double geoGridStartY,
                 double geoGridSpacingX, double geoGridSpacingY,
@@ -105,6 +121,9 @@ class isce::geometry::Geocode {
 
         inline void linesPerBlock(size_t linesPerBlock);
 
+        /** Set number of columns per geocoded tile (0 for full width) */
+        inline void columnsPerBlock(size_t columnsPerBlock);
+
         inline void demBlockMargin(double demBlockMargin);
 
         inline void radarBlockMargin(int radarBlockMargin);
@@ -117,8 +136,33 @@ class isce::geometry::Geocode {
 
     private:
 
+        void _geocodeBlock(isce::io::Raster & inputRaster,
+                        isce::io::Raster & outputRaster,
+                        isce::geometry::DEMInterpolator & demInterp,
+                        isce::core::ProjectionBase * proj,
+                        size_t nbands,
+                        size_t lineStart, size_t geoBlockLength,
+                        size_t pixelStart, size_t geoBlockWidth,
+                        bool parallel);
+
+        void _geocodeBlock(std::vector<isce::io::Raster> & inputRasters,
+                        std::vector<isce::io::Raster> & outputRasters,
+                        const isce::geometry::GeocodeLookupTable & lookupTable,
+                        size_t lineStart, size_t geoBlockLength,
+                        size_t pixelStart, size_t geoBlockWidth,
+                        bool parallel);
+
+        void _geocodeBands(isce::io::Raster & inputRaster,
+                        isce::io::Raster & outputRaster,
+                        std::valarray<double> & radarX, std::valarray<double> & radarY,
+                        int azimuthFirstLine, int rangeFirstPixel,
+                        size_t rdrBlockLength, size_t rdrBlockWidth,
+                        size_t lineStart, size_t pixelStart,
+                        isce::core::Matrix<T> & geoDataBlock,
+                        bool parallel);
+
         void _computeRangeAzimuthBoundingBox(int lineStart, 
-                        int blockLength, int blockWidth,
+                        int blockLength, int pixelStart, int blockWidth,
                         int margin, isce::geometry::DEMInterpolator & demInterp,
                         isce::core::ProjectionBase * proj,
                         int & azimuthFirstLine, int & azimuthLastLine,
@@ -128,7 +172,7 @@ class isce::geometry::Geocode {
                     isce::geometry::DEMInterpolator & demInterp,
                     isce::core::ProjectionBase * _proj,
                     int lineStart, int blockLength,
-                    int blockWidth, double demMargin);
+                    int pixelStart, int blockWidth, double demMargin);
 
         void _geo2rdr(double x, double y,
                     double & azimuthTime, double & slantRange,
@@ -138,7 +182,13 @@ class isce::geometry::Geocode {
         void _interpolate(isce::core::Matrix<T>& rdrDataBlock, 
                     isce::core::Matrix<T>& geoDataBlock,
                     std::valarray<double>& radarX, std::valarray<double>& radarY,
-                    int rdrBlockWidth, int rdrBlockLength);
+                    int rdrBlockWidth, int rdrBlockLength, bool parallel);
+
+        void _interpolateBands(const std::valarray<T> & rdrBands,
+                    std::valarray<T> & geoBands, size_t nbands,
+                    std::valarray<double>& radarX, std::valarray<double>& radarY,
+                    size_t geoBlockWidth, size_t geoBlockLength,
+                    int rdrBlockWidth, int rdrBlockLength, bool parallel);
         
 
     private:
@@ -151,6 +201,7 @@ class isce::geometry::Geocode {
         double _threshold;
         int _numiter;
         size_t _linesPerBlock = 1000;
+        size_t _columnsPerBlock = 0;
         isce::core::orbitInterpMethod _orbitMethod;
 
         // radar grids parameters
@@ -191,6 +242,9 @@ class isce::geometry::Geocode {
         //interpolator 
         isce::core::Interpolator<T> * _interp = nullptr;
 
+        // maximum taps per axis for interpolation shared across bands
+        static const int MAX_INTERP_TAPS = 32;
+
        
 };
 
@@ -0,0 +1,132 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "GeocodeLookupTable.h"
+
+/** @param[in] geoGridStartX X coordinate of top-left corner of geocoded grid
+  * @param[in] geoGridStartY Y coordinate of top-left corner of geocoded grid
+  * @param[in] geoGridSpacingX X spacing of geocoded grid
+  * @param[in] geoGridSpacingY Y spacing of geocoded grid
+  * @param[in] width Number of columns of geocoded grid
+  * @param[in] length Number of lines of geocoded grid
+  * @param[in] epsgcode EPSG code of geocoded grid
+  * @param[in] decimation Decimation factor of stored grid
+  *
+  * The stored grid spans the geocoded grid and may extend past its last line
+  * and column by less than one decimation interval. */
+isce::geometry::GeocodeLookupTable::
+GeocodeLookupTable(double geoGridStartX, double geoGridStartY,
+                   double geoGridSpacingX, double geoGridSpacingY,
+                   size_t width, size_t length, int epsgcode,
+                   size_t decimation) :
+    _startX(geoGridStartX),
+    _startY(geoGridStartY),
+    _spacingX(geoGridSpacingX),
+    _spacingY(geoGridSpacingY),
+    _width(width),
+    _length(length),
+    _epsg(epsgcode),
+    _decimation(std::max(decimation, (size_t) 1)) {
+
+    // Number of coarse nodes; at least two per direction for interpolation
+    size_t coarseWidth = _width;
+    size_t coarseLength = _length;
+    if (_decimation > 1) {
+        coarseWidth = std::max((std::max(_width, (size_t) 1) + _decimation - 2)
+                               / _decimation + 1, (size_t) 2);
+        coarseLength = std::max((std::max(_length, (size_t) 1) + _decimation - 2)
+                                / _decimation + 1, (size_t) 2);
+    }
+    _radarLine.resize(coarseLength, coarseWidth);
+    _radarPixel.resize(coarseLength, coarseWidth);
+    _radarLine.fill(std::numeric_limits<float>::quiet_NaN());
+    _radarPixel.fill(std::numeric_limits<float>::quiet_NaN());
+}
+
+/** @param[out] geoTrans Array of 6 GDAL geotransform coefficients */
+void isce::geometry::GeocodeLookupTable::
+geoTransform(double * geoTrans) const {
+    geoTrans[0] = _startX;
+    geoTrans[1] = _spacingX;
+    geoTrans[2] = 0.0;
+    geoTrans[3] = _startY;
+    geoTrans[4] = 0.0;
+    geoTrans[5] = _spacingY;
+}
+
+/** @param[in] lineStart First line of block in geocoded grid
+  * @param[in] blockLength Number of lines in block
+  * @param[in] pixelStart First pixel of block in geocoded grid
+  * @param[in] blockWidth Number of pixels in block
+  * @param[out] rdrLine Radar lines of block (row major)
+  * @param[out] rdrPixel Radar pixels of block (row major) */
+void isce::geometry::GeocodeLookupTable::
+radarCoordinates(size_t lineStart, size_t blockLength,
+                 size_t pixelStart, size_t blockWidth,
+                 std::valarray<double> & rdrLine,
+                 std::valarray<double> & rdrPixel) const {
+
+    rdrLine.resize(blockLength * blockWidth);
+    rdrPixel.resize(blockLength * blockWidth);
+
+    #pragma omp parallel for
+    for (size_t i = 0; i < blockLength; ++i) {
+        for (size_t j = 0; j < blockWidth; ++j) {
+            radarCoordinates(lineStart + i, pixelStart + j,
+                             rdrLine[i*blockWidth + j], rdrPixel[i*blockWidth + j]);
+        }
+    }
+}
+
+/** @param[in] lineStart First line of block in geocoded grid
+  * @param[in] blockLength Number of lines in block
+  * @param[in] pixelStart First pixel of block in geocoded grid
+  * @param[in] blockWidth Number of pixels in block
+  * @param[out] firstLine Minimum radar line of block
+  * @param[out] lastLine Maximum radar line of block
+  * @param[out] firstPixel Minimum radar pixel of block
+  * @param[out] lastPixel Maximum radar pixel of block
+  * @returns True if the block has at least one valid node
+  *
+  * Uses the stored nodes enclosing the block, so the box is conservative for
+  * decimated tables. */
+bool isce::geometry::GeocodeLookupTable::
+radarBoundingBox(size_t lineStart, size_t blockLength,
+                 size_t pixelStart, size_t blockWidth,
+                 double & firstLine, double & lastLine,
+                 double & firstPixel, double & lastPixel) const {
+
+    // Stored nodes enclosing the block
+    const size_t rowStart = lineStart / _decimation;
+    const size_t colStart = pixelStart / _decimation;
+    const size_t rowEnd = std::min((lineStart + blockLength + _decimation - 2) / _decimation,
+                                   coarseLength() - 1);
+    const size_t colEnd = std::min((pixelStart + blockWidth + _decimation - 2) / _decimation,
+                                   coarseWidth() - 1);
+
+    firstLine = firstPixel = std::numeric_limits<double>::max();
+    lastLine = lastPixel = std::numeric_limits<double>::lowest();
+    bool valid = false;
+    for (size_t row = rowStart; row <= rowEnd; ++row) {
+        for (size_t col = colStart; col <= colEnd; ++col) {
+            const double y = _radarLine(row, col);
+            const double x = _radarPixel(row, col);
+            if (std::isnan(y) || std::isnan(x))
+                continue;
+            firstLine = std::min(firstLine, y);
+            lastLine = std::max(lastLine, y);
+            firstPixel = std::min(firstPixel, x);
+            lastPixel = std::max(lastPixel, x);
+            valid = true;
+        }
+    }
+    return valid;
+}
+
+// end of file
@@ -0,0 +1,157 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#ifndef ISCE_GEOMETRY_GEOCODELOOKUPTABLE_H
+#define ISCE_GEOMETRY_GEOCODELOOKUPTABLE_H
+
+#include <algorithm>
+#include <cmath>
+#include <valarray>
+
+// isce::core
+#include <isce/core/Matrix.h>
+
+// Declaration
+namespace isce {
+    namespace geometry {
+        class GeocodeLookupTable;
+    }
+}
+
+/** Geo to radar lookup table for a geocoded grid.
+ *
+ * Stores the (fractional) radar line and pixel of every node of a geocoded grid,
+ * optionally on a coarse grid decimated by an integer factor in both directions.
+ * Values at full resolution are obtained by bilinear interpolation of the coarse
+ * grid. Radar coordinates are stored in single precision; nodes without a valid
+ * geo2rdr solution are NaN. A table computed once can be reused for geocoding any
+ * number of rasters sharing the same radar and geocoded grids. */
+class isce::geometry::GeocodeLookupTable {
+
+    public:
+        /** Default constructor */
+        GeocodeLookupTable() {}
+
+        /** Constructor from geocoded grid (top-left corner convention of geoGrid) */
+        GeocodeLookupTable(double geoGridStartX, double geoGridStartY,
+                           double geoGridSpacingX, double geoGridSpacingY,
+                           size_t width, size_t length, int epsgcode,
+                           size_t decimation = 1);
+
+        /** Number of columns of geocoded grid */
+        inline size_t width() const { return _width; }
+
+        /** Number of lines of geocoded grid */
+        inline size_t length() const { return _length; }
+
+        /** Decimation factor of stored grid */
+        inline size_t decimation() const { return _decimation; }
+
+        /** EPSG code of geocoded grid */
+        inline int epsg() const { return _epsg; }
+
+        /** X coordinate of top-left corner of geocoded grid */
+        inline double geoGridStartX() const { return _startX; }
+
+        /** Y coordinate of top-left corner of geocoded grid */
+        inline double geoGridStartY() const { return _startY; }
+
+        /** X spacing of geocoded grid */
+        inline double geoGridSpacingX() const { return _spacingX; }
+
+        /** Y spacing of geocoded grid */
+        inline double geoGridSpacingY() const { return _spacingY; }
+
+        /** GDAL-style geotransform of geocoded grid */
+        void geoTransform(double * geoTrans) const;
+
+        /** Number of columns of stored (coarse) grid */
+        inline size_t coarseWidth() const { return _radarLine.width(); }
+
+        /** Number of lines of stored (coarse) grid */
+        inline size_t coarseLength() const { return _radarLine.length(); }
+
+        /** X coordinate (pixel center) of stored grid column */
+        inline double coarseX(size_t col) const {
+            return _startX + _spacingX * (0.5 + col * _decimation);
+        }
+
+        /** Y coordinate (pixel center) of stored grid row */
+        inline double coarseY(size_t row) const {
+            return _startY + _spacingY * (0.5 + row * _decimation);
+        }
+
+        /** Stored radar lines (coarse grid) */
+        inline isce::core::Matrix<float> & radarLine() { return _radarLine; }
+        inline const isce::core::Matrix<float> & radarLine() const { return _radarLine; }
+
+        /** Stored radar pixels (coarse grid) */
+        inline isce::core::Matrix<float> & radarPixel() { return _radarPixel; }
+        inline const isce::core::Matrix<float> & radarPixel() const { return _radarPixel; }
+
+        /** Radar line and pixel of a geocoded grid pixel */
+        inline void radarCoordinates(size_t line, size_t pixel,
+                                     double & rdrLine, double & rdrPixel) const;
+
+        /** Radar lines and pixels of a block of the geocoded grid */
+        void radarCoordinates(size_t lineStart, size_t blockLength,
+                              size_t pixelStart, size_t blockWidth,
+                              std::valarray<double> & rdrLine,
+                              std::valarray<double> & rdrPixel) const;
+
+        /** Radar bounding box of a block of the geocoded grid */
+        bool radarBoundingBox(size_t lineStart, size_t blockLength,
+                              size_t pixelStart, size_t blockWidth,
+                              double & firstLine, double & lastLine,
+                              double & firstPixel, double & lastPixel) const;
+
+    private:
+        // Geocoded grid
+        double _startX = 0.0;
+        double _startY = 0.0;
+        double _spacingX = 1.0;
+        double _spacingY = 1.0;
+        size_t _width = 0;
+        size_t _length = 0;
+        int _epsg = 4326;
+        size_t _decimation = 1;
+
+        // Radar coordinates on coarse grid
+        isce::core::Matrix<float> _radarLine;
+        isce::core::Matrix<float> _radarPixel;
+};
+
+/** @param[in] line Line of geocoded grid
+  * @param[in] pixel Pixel of geocoded grid
+  * @param[out] rdrLine Radar line (NaN if invalid)
+  * @param[out] rdrPixel Radar pixel (NaN if invalid) */
+inline void isce::geometry::GeocodeLookupTable::
+radarCoordinates(size_t line, size_t pixel, double & rdrLine, double & rdrPixel) const {
+
+    // Direct lookup at full resolution
+    if (_decimation == 1) {
+        rdrLine = _radarLine(line, pixel);
+        rdrPixel = _radarPixel(line, pixel);
+        return;
+    }
+
+    // Bilinear interpolation on coarse grid
+    const size_t row = std::min(line / _decimation, coarseLength() - 2);
+    const size_t col = std::min(pixel / _decimation, coarseWidth() - 2);
+    const double ty = static_cast<double>(line) / _decimation - row;
+    const double tx = static_cast<double>(pixel) / _decimation - col;
+    const double w00 = (1.0 - ty) * (1.0 - tx);
+    const double w01 = (1.0 - ty) * tx;
+    const double w10 = ty * (1.0 - tx);
+    const double w11 = ty * tx;
+    rdrLine = w00 * _radarLine(row, col) + w01 * _radarLine(row, col+1)
+            + w10 * _radarLine(row+1, col) + w11 * _radarLine(row+1, col+1);
+    rdrPixel = w00 * _radarPixel(row, col) + w01 * _radarPixel(row, col+1)
+             + w10 * _radarPixel(row+1, col) + w11 * _radarPixel(row+1, col+1);
+}
+
+#endif
+
+// end of file
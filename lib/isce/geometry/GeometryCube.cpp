@@ -0,0 +1,300 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#include <algorithm>
+#include <cmath>
+
+// isce::core
+#include <isce/core/Projections.h>
+
+// isce::except
+#include <isce/except/Error.h>
+
+// isce::geometry
+#include "GeometryCube.h"
+
+using isce::core::Mat3;
+using isce::core::Vec3;
+
+// Maximum number of interpolation taps per axis
+static const int MAX_CUBE_TAPS = 16;
+
+/** @param[in] radarGrid RadarGridParameters defining lines and range bins
+  * @param[in] heights Heights above ellipsoid of cube slices (increasing)
+  * @param[in] azimuthDecimation Lines between coarse grid nodes
+  * @param[in] rangeDecimation Range bins between coarse grid nodes
+  * @param[in] epsgOut EPSG code of x/y layers */
+isce::geometry::GeometryCube::
+GeometryCube(const isce::product::RadarGridParameters & radarGrid,
+             const std::vector<double> & heights,
+             size_t azimuthDecimation,
+             size_t rangeDecimation,
+             int epsgOut) :
+    GeometryCube(radarGrid.sensingStart(),
+                 radarGrid.numberAzimuthLooks() / radarGrid.prf(),
+                 radarGrid.length(),
+                 radarGrid.startingRange(),
+                 radarGrid.numberRangeLooks() * radarGrid.rangePixelSpacing(),
+                 radarGrid.width(),
+                 heights, azimuthDecimation, rangeDecimation, epsgOut) {}
+
+/** @param[in] azimuthStart Azimuth time of first line
+  * @param[in] azimuthSpacing Azimuth time between lines
+  * @param[in] length Number of lines
+  * @param[in] startingRange Slant range of first range bin
+  * @param[in] rangeSpacing Slant range between range bins
+  * @param[in] width Number of range bins
+  * @param[in] heights Heights above ellipsoid of cube slices (increasing)
+  * @param[in] azimuthDecimation Lines between coarse grid nodes
+  * @param[in] rangeDecimation Range bins between coarse grid nodes
+  * @param[in] epsgOut EPSG code of x/y layers */
+isce::geometry::GeometryCube::
+GeometryCube(double azimuthStart, double azimuthSpacing, size_t length,
+             double startingRange, double rangeSpacing, size_t width,
+             const std::vector<double> & heights,
+             size_t azimuthDecimation,
+             size_t rangeDecimation,
+             int epsgOut) :
+    RadarGridCube(azimuthStart, azimuthSpacing, length,
+                  startingRange, rangeSpacing, width,
+                  heights, azimuthDecimation, rangeDecimation),
+    _epsgOut(epsgOut) {
+
+    // Layers on the coarse nodes
+    _layers.resize(CUBE_NLAYERS);
+    for (auto & cube : _layers) {
+        cube.resize(heights.size(), coarseLength(), coarseWidth());
+        cube.zeros();
+    }
+
+    interpMethod(_interpMethod);
+}
+
+/** @param[in] method Interpolation method providing separable weights */
+void isce::geometry::GeometryCube::
+interpMethod(isce::core::dataInterpMethod method) {
+    std::shared_ptr<isce::core::Interpolator<double>> interp(
+        isce::core::createInterpolator<double>(method));
+    if (interp->taps() < 1 || interp->taps() > MAX_CUBE_TAPS) {
+        throw isce::except::InvalidArgument(ISCE_SRCINFO(),
+            "GeometryCube interpolation method must provide separable weights");
+    }
+    _interpMethod = method;
+    _interp = interp;
+}
+
+/** @param[in] layer Layer
+  * @returns Name of HDF5 dataset holding the layer */
+std::string isce::geometry::GeometryCube::
+layerName(geometryCubeLayer layer) {
+    static const char * names[CUBE_NLAYERS] = {
+        "coordinateX", "coordinateY", "incidenceAngle", "losAzimuthAngle",
+        "losUnitVectorEast", "losUnitVectorNorth", "losUnitVectorUp"
+    };
+    return names[layer];
+}
+
+/** @param[in] orbit Orbit object
+  * @param[in] ellipsoid Ellipsoid object
+  * @param[in] lookSide +1 for left and -1 for right
+  * @param[in] orbitMethod Orbit interpolation method */
+void isce::geometry::GeometryCube::
+compute(const isce::core::Orbit & orbit,
+        const isce::core::Ellipsoid & ellipsoid,
+        int lookSide,
+        isce::core::orbitInterpMethod orbitMethod) {
+
+    // Ground targets on every node
+    _computeTargets(orbit, ellipsoid, lookSide, orbitMethod);
+
+    const double degrees = 180.0 / M_PI;
+    const size_t nheights = heights().size();
+    const size_t nrows = coarseLength();
+    const size_t ncols = coarseWidth();
+
+    #pragma omp parallel
+    {
+    // Projection objects are not shared between threads
+    isce::core::ProjectionBase * proj = isce::core::createProj(_epsgOut);
+
+    #pragma omp for schedule(dynamic)
+    for (size_t row = 0; row < nrows; ++row) {
+
+        const double * p = _platformPosition(row);
+        const Vec3 pos{p[0], p[1], p[2]};
+
+        for (size_t k = 0; k < nheights; ++k) {
+            for (size_t col = 0; col < ncols; ++col) {
+
+                const double * llh = _targetLLH(k, row, col);
+                const double * xyz = _targetXYZ(k, row, col);
+                const isce::core::cartesian_t targetLLH{llh[0], llh[1], llh[2]};
+                const Vec3 targetXYZ{xyz[0], xyz[1], xyz[2]};
+
+                // Output coordinates
+                isce::core::cartesian_t xyzOut;
+                proj->forward(targetLLH, xyzOut);
+                _layers[CUBE_X](k, row, col) = xyzOut[0];
+                _layers[CUBE_Y](k, row, col) = xyzOut[1];
+
+                // Line of sight in ENU coordinates around target
+                const Vec3 satToGround = targetXYZ - pos;
+                const Mat3 xyz2enu = Mat3::xyzToEnu(targetLLH[1], targetLLH[0]);
+                const Vec3 enu = xyz2enu.dot(satToGround);
+                const double enuNorm = enu.norm();
+
+                _layers[CUBE_INC](k, row, col) = std::acos(std::abs(enu[2]) / enuNorm) * degrees;
+                _layers[CUBE_HDG](k, row, col) =
+                    (std::atan2(-enu[1], -enu[0]) - (0.5*M_PI)) * degrees;
+                _layers[CUBE_LOS_EAST](k, row, col) = -enu[0] / enuNorm;
+                _layers[CUBE_LOS_NORTH](k, row, col) = -enu[1] / enuNorm;
+                _layers[CUBE_LOS_UP](k, row, col) = -enu[2] / enuNorm;
+            }
+        }
+    }
+
+    delete proj;
+    } // end omp parallel
+}
+
+/** @param[in] t Coordinate along coarse axis
+  * @param[in] n Number of coarse nodes along axis (at least 2)
+  * @param[out] index Node indices within [0, n)
+  * @param[out] weight Node weights
+  *
+  * The interpolator is given an axis padded by taps() nodes on each side so that
+  * its own edge clamping (e.g. the spline never uses the first sample) does not
+  * apply and the stencil is the same everywhere. Stencil nodes beyond either end
+  * of the axis are then replaced by linear extrapolation of the two end nodes,
+  * which keeps the interpolant exact for linear data up to the edges. */
+void isce::geometry::GeometryCube::
+_axisWeights(double t, size_t n, int * index, double * weight) const {
+    const int taps = _interp->taps();
+    const int last = static_cast<int>(n) - 1;
+    t = std::min(std::max(t, 0.0), static_cast<double>(last));
+    _interp->weights(t + taps, n + 2 * taps, index, weight);
+    for (int i = 0; i < taps; ++i) {
+        index[i] -= taps;
+    }
+
+    // Locate the end nodes in the stencil
+    int first0 = -1, first1 = -1, last0 = -1, last1 = -1;
+    for (int i = 0; i < taps; ++i) {
+        if (index[i] == 0) first0 = i;
+        if (index[i] == 1) first1 = i;
+        if (index[i] == last) last0 = i;
+        if (index[i] == last - 1) last1 = i;
+    }
+
+    // Fold out-of-range nodes onto the end nodes
+    for (int i = 0; i < taps; ++i) {
+        if (index[i] < 0 && first0 >= 0 && first1 >= 0) {
+            const double m = index[i];
+            weight[first0] += (1.0 - m) * weight[i];
+            weight[first1] += m * weight[i];
+        } else if (index[i] > last && last0 >= 0 && last1 >= 0) {
+            const double m = index[i] - last;
+            weight[last0] += (1.0 + m) * weight[i];
+            weight[last1] -= m * weight[i];
+        } else {
+            continue;
+        }
+        weight[i] = 0.0;
+        index[i] = std::min(std::max(index[i], 0), last);
+    }
+    for (int i = 0; i < taps; ++i) {
+        index[i] = std::min(std::max(index[i], 0), last);
+    }
+}
+
+/** @param[in] layer Layer to evaluate
+  * @param[in] line Line index (may be fractional)
+  * @param[in] rbin Range bin (may be fractional)
+  * @param[in] height Height above ellipsoid */
+double isce::geometry::GeometryCube::
+evaluate(geometryCubeLayer layer, double line, double rbin, double height) const {
+
+    // Separable weights in azimuth and range
+    const int taps = _interp->taps();
+    int irow[MAX_CUBE_TAPS], icol[MAX_CUBE_TAPS];
+    double wrow[MAX_CUBE_TAPS], wcol[MAX_CUBE_TAPS];
+    _axisWeights(line / azimuthDecimation(), coarseLength(), irow, wrow);
+    _axisWeights(rbin / rangeDecimation(), coarseWidth(), icol, wcol);
+
+    // Linear in height
+    size_t k;
+    double tz;
+    _heightIndex(height, k, tz);
+    const size_t k1 = std::min(k + 1, heights().size() - 1);
+
+    const isce::core::Cube<double> & cube = _layers[layer];
+    double value = 0.0;
+    for (int i = 0; i < taps; ++i) {
+        double sum = 0.0;
+        for (int j = 0; j < taps; ++j) {
+            sum += wcol[j] * ((1.0 - tz) * cube(k, irow[i], icol[j])
+                              + tz * cube(k1, irow[i], icol[j]));
+        }
+        value += wrow[i] * sum;
+    }
+    return value;
+}
+
+/** @param[in] layer Layer to evaluate
+  * @param[in] line Line index
+  * @param[in] height Height above ellipsoid
+  * @param[out] out Layer values for range bins [0, width) */
+void isce::geometry::GeometryCube::
+evaluateLine(geometryCubeLayer layer, size_t line, double height, double * out) const {
+
+    // Azimuth and height weights are shared by the whole line
+    const int taps = _interp->taps();
+    int irow[MAX_CUBE_TAPS], icol[MAX_CUBE_TAPS];
+    double wrow[MAX_CUBE_TAPS], wcol[MAX_CUBE_TAPS];
+    _axisWeights(static_cast<double>(line) / azimuthDecimation(), coarseLength(), irow, wrow);
+    size_t k;
+    double tz;
+    _heightIndex(height, k, tz);
+    const size_t k1 = std::min(k + 1, heights().size() - 1);
+
+    // Collapse the cube to a single coarse line
+    const isce::core::Cube<double> & cube = _layers[layer];
+    const size_t ncols = coarseWidth();
+    std::vector<double> coarseLine(ncols, 0.0);
+    for (int i = 0; i < taps; ++i) {
+        const double w0 = wrow[i] * (1.0 - tz);
+        const double w1 = wrow[i] * tz;
+        const double * v0 = &cube(k, irow[i], 0);
+        const double * v1 = &cube(k1, irow[i], 0);
+        for (size_t col = 0; col < ncols; ++col) {
+            coarseLine[col] += w0 * v0[col] + w1 * v1[col];
+        }
+    }
+
+    // Interpolation in range
+    const double rdec = rangeDecimation();
+    for (size_t rbin = 0; rbin < width(); ++rbin) {
+        _axisWeights(rbin / rdec, ncols, icol, wcol);
+        double value = 0.0;
+        for (int j = 0; j < taps; ++j) {
+            value += wcol[j] * coarseLine[icol[j]];
+        }
+        out[rbin] = value;
+    }
+}
+
+/** @param[in] layer Layer to evaluate
+  * @param[in] line Line index
+  * @param[in] height Height above ellipsoid
+  * @param[out] out Layer values for range bins [0, width) */
+void isce::geometry::GeometryCube::
+evaluateLine(geometryCubeLayer layer, size_t line, double height,
+             std::valarray<double> & out) const {
+    if (out.size() != width())
+        out.resize(width());
+    evaluateLine(layer, line, height, &out[0]);
+}
+
+// end of file
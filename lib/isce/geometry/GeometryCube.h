@@ -0,0 +1,131 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#ifndef ISCE_GEOMETRY_GEOMETRYCUBE_H
+#define ISCE_GEOMETRY_GEOMETRYCUBE_H
+
+#include <memory>
+#include <valarray>
+#include <vector>
+
+// isce::core
+#include <isce/core/Constants.h>
+#include <isce/core/Cube.h>
+#include <isce/core/Ellipsoid.h>
+#include <isce/core/Interpolator.h>
+#include <isce/core/Orbit.h>
+
+// isce::product
+#include <isce/product/RadarGridParameters.h>
+
+// isce::geometry
+#include "RadarGridCube.h"
+
+// Declaration
+namespace isce {
+    namespace geometry {
+        class GeometryCube;
+
+        /** Layers of a geometry cube */
+        enum geometryCubeLayer {
+            CUBE_X = 0,         /**< X coordinate in output EPSG */
+            CUBE_Y,             /**< Y coordinate in output EPSG */
+            CUBE_INC,           /**< Incidence angle (degrees) */
+            CUBE_HDG,           /**< LOS azimuth angle (degrees), same convention as Topo */
+            CUBE_LOS_EAST,      /**< East component of unit vector from target to sensor */
+            CUBE_LOS_NORTH,     /**< North component of unit vector from target to sensor */
+            CUBE_LOS_UP,        /**< Up component of unit vector from target to sensor */
+            CUBE_NLAYERS
+        };
+    }
+}
+
+/** Radar geometry layers on a sparse azimuth x range x height grid.
+ *
+ * Zero-Doppler rdr2geo is solved for every node of a RadarGridCube (decimated
+ * radar grid and a small set of heights above the ellipsoid). Each layer is
+ * stored as a Cube (height x coarse line x coarse range bin) and can be evaluated
+ * at any radar pixel and height by separable interpolation in azimuth and range
+ * (any isce::core::Interpolator that provides weights, e.g. bilinear, bicubic or
+ * biquintic) and linear interpolation in height. */
+class isce::geometry::GeometryCube : public isce::geometry::RadarGridCube {
+
+    public:
+        /** Default constructor */
+        GeometryCube() { interpMethod(_interpMethod); }
+
+        /** Constructor from radar grid */
+        GeometryCube(const isce::product::RadarGridParameters & radarGrid,
+                     const std::vector<double> & heights,
+                     size_t azimuthDecimation = 100,
+                     size_t rangeDecimation = 100,
+                     int epsgOut = 4326);
+
+        /** Constructor from explicit azimuth and range sampling */
+        GeometryCube(double azimuthStart, double azimuthSpacing, size_t length,
+                     double startingRange, double rangeSpacing, size_t width,
+                     const std::vector<double> & heights,
+                     size_t azimuthDecimation = 100,
+                     size_t rangeDecimation = 100,
+                     int epsgOut = 4326);
+
+        /** Compute all layers on the coarse grid */
+        void compute(const isce::core::Orbit & orbit,
+                     const isce::core::Ellipsoid & ellipsoid,
+                     int lookSide,
+                     isce::core::orbitInterpMethod orbitMethod =
+                         isce::core::HERMITE_METHOD);
+
+        /** Set interpolation method used in azimuth and range */
+        void interpMethod(isce::core::dataInterpMethod method);
+
+        /** Get interpolation method used in azimuth and range */
+        inline isce::core::dataInterpMethod interpMethod() const { return _interpMethod; }
+
+        /** Value of a layer at a (fractional) line, range bin and height */
+        double evaluate(geometryCubeLayer layer, double line, double rbin,
+                        double height) const;
+
+        /** Values of a layer for all range bins of a line */
+        void evaluateLine(geometryCubeLayer layer, size_t line, double height,
+                          double * out) const;
+
+        /** Values of a layer for all range bins of a line */
+        void evaluateLine(geometryCubeLayer layer, size_t line, double height,
+                          std::valarray<double> & out) const;
+
+        /** EPSG code of x/y layers */
+        inline int epsg() const { return _epsgOut; }
+
+        /** Layer values (height x coarse line x coarse range bin) */
+        inline isce::core::Cube<double> & layer(geometryCubeLayer layer) {
+            return _layers[layer];
+        }
+        inline const isce::core::Cube<double> & layer(geometryCubeLayer layer) const {
+            return _layers[layer];
+        }
+
+        /** Name of a layer used for storage */
+        static std::string layerName(geometryCubeLayer layer);
+
+    private:
+        /** Interpolation weights along one coarse axis */
+        void _axisWeights(double t, size_t n, int * index, double * weight) const;
+
+    private:
+        // Output coordinate system of x/y layers
+        int _epsgOut = 4326;
+
+        // Layers on coarse grid
+        std::vector<isce::core::Cube<double>> _layers;
+
+        // Interpolator providing separable weights in azimuth and range
+        isce::core::dataInterpMethod _interpMethod = isce::core::BILINEAR_METHOD;
+        std::shared_ptr<isce::core::Interpolator<double>> _interp;
+};
+
+#endif
+
+// end of file
@@ -0,0 +1,182 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#include <algorithm>
+#include <cmath>
+
+// isce::core
+#include <isce/core/Basis.h>
+#include <isce/core/Pixel.h>
+
+// isce::geometry
+#include "DEMInterpolator.h"
+#include "geometry.h"
+#include "IncidenceAngleTable.h"
+
+using isce::core::Basis;
+using isce::core::Mat3;
+using isce::core::Pixel;
+using isce::core::Vec3;
+
+/** @param[in] radarGrid RadarGridParameters defining lines and range bins
+  * @param[in] orbit Orbit object
+  * @param[in] ellipsoid Ellipsoid object
+  * @param[in] lookSide +1 for left and -1 for right
+  * @param[in] height Constant height above ellipsoid of targets
+  * @param[in] rangeDecimation Range bins between coarse grid nodes
+  * @param[in] orbitMethod Orbit interpolation method */
+isce::geometry::IncidenceAngleTable::
+IncidenceAngleTable(const isce::product::RadarGridParameters & radarGrid,
+                    const isce::core::Orbit & orbit,
+                    const isce::core::Ellipsoid & ellipsoid,
+                    int lookSide,
+                    double height,
+                    size_t rangeDecimation,
+                    isce::core::orbitInterpMethod orbitMethod) :
+    IncidenceAngleTable(radarGrid.sensingStart(),
+                        radarGrid.numberAzimuthLooks() / radarGrid.prf(),
+                        radarGrid.length(),
+                        radarGrid.startingRange(),
+                        radarGrid.numberRangeLooks() * radarGrid.rangePixelSpacing(),
+                        radarGrid.width(),
+                        orbit, ellipsoid, lookSide, height,
+                        rangeDecimation, orbitMethod) {}
+
+/** @param[in] azimuthStart Azimuth time of first line
+  * @param[in] azimuthSpacing Azimuth time between lines
+  * @param[in] length Number of lines
+  * @param[in] startingRange Slant range of first range bin
+  * @param[in] rangeSpacing Slant range between range bins
+  * @param[in] width Number of range bins
+  * @param[in] orbit Orbit object
+  * @param[in] ellipsoid Ellipsoid object
+  * @param[in] lookSide +1 for left and -1 for right
+  * @param[in] height Constant height above ellipsoid of targets
+  * @param[in] rangeDecimation Range bins between coarse grid nodes
+  * @param[in] orbitMethod Orbit interpolation method */
+isce::geometry::IncidenceAngleTable::
+IncidenceAngleTable(double azimuthStart, double azimuthSpacing, size_t length,
+                    double startingRange, double rangeSpacing, size_t width,
+                    const isce::core::Orbit & orbit,
+                    const isce::core::Ellipsoid & ellipsoid,
+                    int lookSide,
+                    double height,
+                    size_t rangeDecimation,
+                    isce::core::orbitInterpMethod orbitMethod) :
+    _azimuthStart(azimuthStart),
+    _azimuthSpacing(azimuthSpacing),
+    _length(length),
+    _startingRange(startingRange),
+    _rangeSpacing(rangeSpacing),
+    _width(width),
+    _rangeDecimation(std::max(rangeDecimation, (size_t) 1)) {
+
+    // Coarse nodes covering [0, width - 1] plus padding on both ends
+    const size_t nspan = (std::max(_width, (size_t) 2) - 2) / _rangeDecimation + 2;
+    const size_t ncoarse = nspan + 2 * PAD;
+    _sinInc.resize(_length, ncoarse);
+    _curvature.resize(_length, ncoarse);
+
+    _computeTable(orbit, ellipsoid, lookSide, height, orbitMethod);
+}
+
+void isce::geometry::IncidenceAngleTable::
+_computeTable(const isce::core::Orbit & orbit,
+              const isce::core::Ellipsoid & ellipsoid,
+              int lookSide, double height,
+              isce::core::orbitInterpMethod orbitMethod) {
+
+    // Constant height DEM
+    const DEMInterpolator flatInterp(height);
+    const size_t ncoarse = _sinInc.width();
+
+    #pragma omp parallel
+    {
+    // Spline work array
+    std::valarray<double> work(ncoarse);
+
+    #pragma omp for schedule(dynamic)
+    for (size_t line = 0; line < _length; ++line) {
+
+        // Platform state for this line is interpolated once
+        const double tline = _azimuthStart + line * _azimuthSpacing;
+        Vec3 pos, vel;
+        orbit.interpolate(tline, pos, vel, orbitMethod);
+        const Basis TCNbasis(pos, vel);
+
+        for (size_t k = 0; k < ncoarse; ++k) {
+
+            // Slant range of coarse node (zero Doppler)
+            const double rbin = (static_cast<double>(k) - PAD) * _rangeDecimation;
+            const double rng = _startingRange + rbin * _rangeSpacing;
+            const Pixel pixel(rng, 0.0, k);
+
+            // Target on constant height surface
+            isce::core::cartesian_t targetLLH{0.0, 0.0, height};
+            rdr2geo(pixel, TCNbasis, pos, vel, ellipsoid, flatInterp, targetLLH,
+                    lookSide, 1.0e-4, 20, 20);
+
+            // Computation of ENU coordinates around ground target
+            const Vec3 targetXYZ = ellipsoid.lonLatToXyz(targetLLH);
+            const Vec3 satToGround = targetXYZ - pos;
+            const Mat3 xyz2enu = Mat3::xyzToEnu(targetLLH[1], targetLLH[0]);
+            const Vec3 enu = xyz2enu.dot(satToGround);
+
+            // Compute incidence angle components
+            const double costheta = std::abs(enu[2]) / enu.norm();
+            _sinInc(line, k) = std::sqrt(1. - costheta*costheta);
+        }
+
+        _initSpline(line, work);
+    }
+    } // end omp parallel
+}
+
+/** @param[in] line Line index
+  * @param[in] work Work array of size coarseWidth()
+  *
+  * Tridiagonal solve for second derivatives with unit node spacing */
+void isce::geometry::IncidenceAngleTable::
+_initSpline(size_t line, std::valarray<double> & work) {
+
+    const size_t n = _sinInc.width();
+    const double * y = _sinInc.rowptr(line);
+    double * m = _curvature.rowptr(line);
+
+    // Natural boundary conditions
+    m[0] = 0.0;
+    work[0] = 0.0;
+    for (size_t i = 1; i < n - 1; ++i) {
+        const double p = 0.5 * m[i-1] + 2.0;
+        m[i] = -0.5 / p;
+        work[i] = (3.0 * (y[i+1] - 2.0 * y[i] + y[i-1]) - 0.5 * work[i-1]) / p;
+    }
+    m[n-1] = 0.0;
+
+    // Back substitution
+    for (size_t i = n - 1; i-- > 0;) {
+        m[i] = m[i] * m[i+1] + work[i];
+    }
+}
+
+/** @param[in] line Line index
+  * @param[out] out Sine of incidence angle for range bins [0, width) */
+void isce::geometry::IncidenceAngleTable::
+sinIncidenceLine(size_t line, double * out) const {
+    for (size_t rbin = 0; rbin < _width; ++rbin) {
+        out[rbin] = sinIncidence(line, rbin);
+    }
+}
+
+/** @param[in] line Line index
+  * @param[out] out Sine of incidence angle for range bins [0, width) */
+void isce::geometry::IncidenceAngleTable::
+sinIncidenceLine(size_t line, std::valarray<double> & out) const {
+    if (out.size() != _width)
+        out.resize(_width);
+    sinIncidenceLine(line, &out[0]);
+}
+
+// end of file
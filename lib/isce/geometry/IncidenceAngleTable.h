@@ -0,0 +1,144 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#ifndef ISCE_GEOMETRY_INCIDENCEANGLETABLE_H
+#define ISCE_GEOMETRY_INCIDENCEANGLETABLE_H
+
+#include <algorithm>
+#include <cmath>
+#include <valarray>
+
+// isce::core
+#include <isce/core/Constants.h>
+#include <isce/core/Ellipsoid.h>
+#include <isce/core/Matrix.h>
+#include <isce/core/Orbit.h>
+
+// isce::product
+#include <isce/product/RadarGridParameters.h>
+
+// Declaration
+namespace isce {
+    namespace geometry {
+        class IncidenceAngleTable;
+    }
+}
+
+/** Per-line table of incidence angles over a constant-height ellipsoid.
+ *
+ * For each azimuth line, the platform state is interpolated once and zero-Doppler
+ * rdr2geo is solved on a coarse, uniformly spaced range grid. Values at full
+ * range resolution are obtained with a natural cubic spline per line. The coarse
+ * grid is padded on both ends so that spline end effects stay outside the swath. */
+class isce::geometry::IncidenceAngleTable {
+
+    public:
+        /** Constructor from radar grid */
+        IncidenceAngleTable(const isce::product::RadarGridParameters & radarGrid,
+                            const isce::core::Orbit & orbit,
+                            const isce::core::Ellipsoid & ellipsoid,
+                            int lookSide,
+                            double height,
+                            size_t rangeDecimation = 32,
+                            isce::core::orbitInterpMethod orbitMethod =
+                                isce::core::HERMITE_METHOD);
+
+        /** Constructor from explicit azimuth and range sampling */
+        IncidenceAngleTable(double azimuthStart, double azimuthSpacing, size_t length,
+                            double startingRange, double rangeSpacing, size_t width,
+                            const isce::core::Orbit & orbit,
+                            const isce::core::Ellipsoid & ellipsoid,
+                            int lookSide,
+                            double height,
+                            size_t rangeDecimation = 32,
+                            isce::core::orbitInterpMethod orbitMethod =
+                                isce::core::HERMITE_METHOD);
+
+        /** Sine of incidence angle at a line and (fractional) range bin */
+        inline double sinIncidence(size_t line, double rbin) const;
+
+        /** Incidence angle (radians) at a line and (fractional) range bin */
+        inline double incidence(size_t line, double rbin) const;
+
+        /** Sine of incidence angle for all range bins of a line */
+        void sinIncidenceLine(size_t line, double * out) const;
+
+        /** Sine of incidence angle for all range bins of a line */
+        void sinIncidenceLine(size_t line, std::valarray<double> & out) const;
+
+        /** Number of lines in table */
+        inline size_t length() const { return _length; }
+
+        /** Number of range bins covered by table */
+        inline size_t width() const { return _width; }
+
+        /** Range decimation factor of coarse grid */
+        inline size_t rangeDecimation() const { return _rangeDecimation; }
+
+        /** Number of coarse range nodes per line */
+        inline size_t coarseWidth() const { return _sinInc.width(); }
+
+        /** Number of coarse nodes padded before the first range bin */
+        static const size_t PAD = 2;
+
+    private:
+        /** Solve for sine of incidence angle on the coarse grid */
+        void _computeTable(const isce::core::Orbit & orbit,
+                           const isce::core::Ellipsoid & ellipsoid,
+                           int lookSide, double height,
+                           isce::core::orbitInterpMethod orbitMethod);
+
+        /** Natural spline second derivatives along one line of the coarse grid */
+        void _initSpline(size_t line, std::valarray<double> & work);
+
+    private:
+        // Azimuth sampling
+        double _azimuthStart;
+        double _azimuthSpacing;
+        size_t _length;
+
+        // Range sampling
+        double _startingRange;
+        double _rangeSpacing;
+        size_t _width;
+        size_t _rangeDecimation;
+
+        // Sine of incidence angle and its spline second derivatives (line x coarse bin)
+        isce::core::Matrix<double> _sinInc;
+        isce::core::Matrix<double> _curvature;
+};
+
+/** @param[in] line Line index
+  * @param[in] rbin Range bin (may be fractional)
+  *
+  * Evaluates the per-line natural cubic spline on the coarse range grid */
+inline double isce::geometry::IncidenceAngleTable::
+sinIncidence(size_t line, double rbin) const {
+
+    // Position on the padded coarse grid
+    const double x = rbin / _rangeDecimation + PAD;
+    const size_t n = _sinInc.width();
+    long j = static_cast<long>(x);
+    j = std::max(0L, std::min(j, static_cast<long>(n) - 2));
+    const double t = x - j;
+    const double u = 1.0 - t;
+
+    // Spline evaluation with unit node spacing
+    const double * y = _sinInc.rowptr(line);
+    const double * m = _curvature.rowptr(line);
+    return u * y[j] + t * y[j+1]
+         + ((u*u*u - u) * m[j] + (t*t*t - t) * m[j+1]) / 6.0;
+}
+
+/** @param[in] line Line index
+  * @param[in] rbin Range bin (may be fractional) */
+inline double isce::geometry::IncidenceAngleTable::
+incidence(size_t line, double rbin) const {
+    return std::asin(sinIncidence(line, rbin));
+}
+
+#endif
+
+// end of file
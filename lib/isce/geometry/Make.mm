@@ -7,9 +7,15 @@ PACKAGE = isce/geometry
 
 # the list of sources
 PROJ_SRCS = \
+    BaselineGrid.cpp \
     DEMInterpolator.cpp \
     Geo2rdr.cpp \
+    Geo2rdrStack.cpp \
+    GeocodeLookupTable.cpp \
+    GeometryCube.cpp \
+    IncidenceAngleTable.cpp \
     geometry.cpp \
+    RadarGridCube.cpp \
     RTC.cpp \
     Topo.cpp \
 
@@ -23,10 +29,16 @@ PROJ_TMPDIR = $(BLD_TMPDIR)/$(PROJECT)-$(PROJECT_MAJOR).$(PROJECT_MINOR)/lib
 EXPORT_LIBS = $(PROJ_DLL)
 # the headers
 EXPORT_PKG_HEADERS = \
+    BaselineGrid.h \
     DEMInterpolator.h \
     Geo2rdr.h \
     Geo2rdr.icc \
+    Geo2rdrStack.h \
+    GeocodeLookupTable.h \
+    GeometryCube.h \
     geometry.h \
+    IncidenceAngleTable.h \
+    RadarGridCube.h \
     RTC.h \
     Topo.h \
     Topo.icc \
@@ -3,6 +3,7 @@
 
 #include "RTC.h"
 
+#include <algorithm>
 #include <complex>
 #include <cmath>
 #include <iostream>
@@ -13,12 +14,14 @@
 #include <complex>
 #include <ctime>
 #include <cstring>
+#include <vector>
 
 #include <isce/core/Constants.h>
 #include <isce/core/DateTime.h>
 #include <isce/core/Ellipsoid.h>
 
 #include <isce/geometry/geometry.h>
+#include <isce/geometry/IncidenceAngleTable.h>
 #include <isce/geometry/Topo.h>
 
 using isce::core::cartesian_t;
@@ -59,6 +62,34 @@ double computeUpsamplingFactor(const isce::geometry::DEMInterpolator& dem_interp
     return std::sqrt(demArea / radarArea);
 }
 
+// ECEF facet corners along one DEM y-coordinate, computed on first use. Slot
+// 2*jj holds the left corner of facet jj; the right corner uses slot 2*jj+1
+// unless its x-coordinate is bitwise equal to the next facet's left corner.
+struct LatticeRow {
+    double y;
+    std::vector<Vec3> xyz;
+    std::vector<char> done;
+
+    LatticeRow(size_t nslots) : y(0.0), xyz(nslots), done(nslots, 0) {}
+
+    void reset(double dem_y) {
+        y = dem_y;
+        std::fill(done.begin(), done.end(), 0);
+    }
+
+    const Vec3& corner(size_t slot, double dem_x,
+                       const isce::geometry::DEMInterpolator& dem_interp,
+                       const isce::core::ProjectionBase* proj,
+                       const isce::core::Ellipsoid& ellps) {
+        if (!done[slot]) {
+            const Vec3 demXYZ{dem_x, y, dem_interp.interpolateXY(dem_x, y)};
+            xyz[slot] = ellps.lonLatToXyz(proj->inverse(demXYZ));
+            done[slot] = 1;
+        }
+        return xyz[slot];
+    }
+};
+
 void isce::geometry::facetRTC(isce::product::Product& product,
                               isce::io::Raster& dem,
                               isce::io::Raster& out_raster,
@@ -125,128 +156,155 @@ void isce::geometry::facetRTC(const isce::product::RadarGridParameters& radarGri
     const size_t imax = dem_interp.length() * upsample_factor;
     const size_t jmax = dem_interp.width()  * upsample_factor;
 
-    const size_t progress_block = imax*jmax/100;
+    const size_t progress_block = std::max(imax*jmax/100, (size_t) 1);
     size_t numdone = 0;
 
     const isce::core::ProjectionBase* proj = isce::core::createProj(dem_interp.epsgCode());
 
-    // Loop over DEM facets
-    #pragma omp parallel for schedule(dynamic) collapse(2)
-    for (size_t ii = 0; ii < imax; ++ii) {
-        for (size_t jj = 0; jj < jmax; ++jj) {
+    // Facet corners are evaluated at the same DEM coordinates as independent
+    // per-facet corners would be, so results do not depend on sharing. The
+    // right corner of a facet is shared with the left corner of the next one
+    // only where the two x-coordinates are bitwise equal.
+    std::vector<double> demX0(jmax), demX1(jmax);
+    std::vector<size_t> slotX1(jmax);
+    for (size_t jj = 0; jj < jmax; ++jj) {
+        demX0[jj] = dem_interp.xStart() + dem_interp.deltaX() * jj / upsample_factor;
+        demX1[jj] = demX0[jj] + dem_interp.deltaX() / upsample_factor;
+    }
+    for (size_t jj = 0; jj < jmax; ++jj) {
+        const bool shared = (jj + 1 < jmax) and (demX1[jj] == demX0[jj + 1]);
+        slotX1[jj] = shared ? 2 * (jj + 1) : 2 * jj + 1;
+    }
 
-            #pragma omp atomic
-            numdone++;
+    // Facet rows are swept in blocks. Each block keeps the corners of the
+    // top and bottom edges of the current facet row; the bottom edge becomes
+    // the next top edge when their y-coordinates are bitwise equal.
+    const size_t rowsPerBlock = 64;
+    const size_t nblocks = (imax + rowsPerBlock - 1) / rowsPerBlock;
 
-            if (numdone % progress_block == 0)
-                #pragma omp critical
-                printf("\rRTC progress: %d%%", (int) (numdone * 1e2 / (imax * jmax))),
-                    fflush(stdout);
+    // Loop over blocks of DEM facet rows
+    #pragma omp parallel for schedule(dynamic)
+    for (size_t block = 0; block < nblocks; ++block) {
 
-            // Central DEM coordinates of facets
-            const double dem_ymid = dem_interp.yStart() + dem_interp.deltaY() * (ii + 0.5) / upsample_factor;
-            const double dem_xmid = dem_interp.xStart() + dem_interp.deltaX() * (jj + 0.5) / upsample_factor;
-
-            double a, r;
-            const Vec3 inputDEM{dem_xmid, dem_ymid,
-                dem_interp.interpolateXY(dem_xmid, dem_ymid)};
-            // Compute facet-central LLH vector
-            const Vec3 inputLLH = proj->inverse(inputDEM);
-            //Should incorporate check on return status here
-            isce::geometry::geo2rdr(inputLLH, ellps, orbit, dop,
-                    a, r, radarGrid.wavelength(), 1e-4, 100, 1e-4);
-            const float azpix = (a - start) / pixazm;
-            const float ranpix = (r - r0) / dr;
-
-            // Establish bounds for bilinear weighting model
-            const float x1 = std::floor(ranpix);
-            const float x2 = x1 + 1.0;
-            const float y1 = std::floor(azpix);
-            const float y2 = y1 + 1.0;
-
-            // Check to see if pixel lies in valid RDC range
-            if (ranpix < 0.0 or x2 > xbound or azpix < 0.0 or y2 > ybound)
-                continue;
-
-            // Current x/y-coords in DEM
+        const size_t iistart = block * rowsPerBlock;
+        const size_t iiend = std::min(iistart + rowsPerBlock, imax);
+
+        LatticeRow top(2 * jmax), bottom(2 * jmax);
+
+        for (size_t ii = iistart; ii < iiend; ++ii) {
+
+            // Current y-coords of the facet row in DEM
             const double dem_y0 = dem_interp.yStart() + ii * dem_interp.deltaY() / upsample_factor;
             const double dem_y1 = dem_y0 + dem_interp.deltaY() / upsample_factor;
-            const double dem_x0 = dem_interp.xStart() + dem_interp.deltaX() * jj / upsample_factor;
-            const double dem_x1 = dem_x0 + dem_interp.deltaX() / upsample_factor;
-
-            // Set DEM-coordinate corner vectors
-            const Vec3 dem00 = {dem_x0, dem_y0,
-                dem_interp.interpolateXY(dem_x0, dem_y0)};
-            const Vec3 dem01 = {dem_x0, dem_y1,
-                dem_interp.interpolateXY(dem_x0, dem_y1)};
-            const Vec3 dem10 = {dem_x1, dem_y0,
-                dem_interp.interpolateXY(dem_x1, dem_y0)};
-            const Vec3 dem11 = {dem_x1, dem_y1,
-                dem_interp.interpolateXY(dem_x1, dem_y1)};
-
-            // Convert to XYZ
-            const Vec3 xyz00 = ellps.lonLatToXyz(proj->inverse(dem00));
-            const Vec3 xyz01 = ellps.lonLatToXyz(proj->inverse(dem01));
-            const Vec3 xyz10 = ellps.lonLatToXyz(proj->inverse(dem10));
-            const Vec3 xyz11 = ellps.lonLatToXyz(proj->inverse(dem11));
-
-            // Compute normal vectors for each facet
-            const Vec3 normalFacet1 = normalPlane(xyz00, xyz10, xyz01);
-            const Vec3 normalFacet2 = normalPlane(xyz01, xyz10, xyz11);
-
-            // Side lengths
-            const double p00_01 = (xyz00 - xyz01).norm();
-            const double p00_10 = (xyz00 - xyz10).norm();
-            const double p10_01 = (xyz10 - xyz01).norm();
-            const double p11_01 = (xyz11 - xyz01).norm();
-            const double p11_10 = (xyz11 - xyz10).norm();
-
-            // Semi-perimeters
-            const float h1 = 0.5 * (p00_01 + p00_10 + p10_01);
-            const float h2 = 0.5 * (p11_01 + p11_10 + p10_01);
-
-            // Heron's formula to get area of facets in XYZ coordinates
-            const float AP1 = std::sqrt(h1 * (h1 - p00_01) * (h1 - p00_10) * (h1 - p10_01));
-            const float AP2 = std::sqrt(h2 * (h2 - p11_01) * (h2 - p11_10) * (h2 - p10_01));
-
-            // Compute look angle from sensor to ground
-            const Vec3 xyz_mid = ellps.lonLatToXyz(inputLLH);
-            isce::core::cartesian_t xyz_plat, vel;
-            orbit.interpolateWGS84Orbit(a, xyz_plat, vel);
-            const Vec3 lookXYZ = (xyz_plat - xyz_mid).unitVec();
-
-            // Compute dot product between each facet and look vector
-            const double cosIncFacet1 = lookXYZ.dot(normalFacet1);
-            const double cosIncFacet2 = lookXYZ.dot(normalFacet2);
-            // If facets are not illuminated by radar, skip
-            if (cosIncFacet1 < 0. or cosIncFacet2 < 0.) {
-                continue;
+            if (ii > iistart and bottom.y == dem_y0) {
+                std::swap(top, bottom);
+            } else {
+                top.reset(dem_y0);
             }
+            bottom.reset(dem_y1);
 
-            // Compute projected area
-            const float area = AP1 * cosIncFacet1 + AP2 * cosIncFacet2;
-
-            // Get integer indices of bounds
-            const int ix1 = static_cast<int>(x1);
-            const int ix2 = static_cast<int>(x2);
-            const int iy1 = static_cast<int>(y1);
-            const int iy2 = static_cast<int>(y2);
-
-            // Compute fractional weights from indices
-            const float Wr = ranpix - x1;
-            const float Wa = azpix - y1;
-            const float Wrc = 1. - Wr;
-            const float Wac = 1. - Wa;
-
-            // Use bilinear weighting to distribute area
-            #pragma omp atomic
-            out[radarGrid.width() * iy1 + ix1] += area * Wrc * Wac;
-            #pragma omp atomic
-            out[radarGrid.width() * iy1 + ix2] += area * Wr * Wac;
-            #pragma omp atomic
-            out[radarGrid.width() * iy2 + ix1] += area * Wrc * Wa;
-            #pragma omp atomic
-            out[radarGrid.width() * iy2 + ix2] += area * Wr * Wa;
+            size_t done;
+            #pragma omp atomic capture
+            done = numdone += jmax;
+
+            if ((done / progress_block) != ((done - jmax) / progress_block))
+                #pragma omp critical
+                printf("\rRTC progress: %d%%", (int) (done * 1e2 / (imax * jmax))),
+                    fflush(stdout);
+
+            // Central DEM y-coordinate of facets in this row
+            const double dem_ymid = dem_interp.yStart() + dem_interp.deltaY() * (ii + 0.5) / upsample_factor;
+
+            for (size_t jj = 0; jj < jmax; ++jj) {
+
+                // Central DEM x-coordinate of facet
+                const double dem_xmid = dem_interp.xStart() + dem_interp.deltaX() * (jj + 0.5) / upsample_factor;
+
+                double a, r;
+                const Vec3 inputDEM{dem_xmid, dem_ymid,
+                    dem_interp.interpolateXY(dem_xmid, dem_ymid)};
+                // Compute facet-central LLH vector
+                const Vec3 inputLLH = proj->inverse(inputDEM);
+                //Should incorporate check on return status here
+                isce::geometry::geo2rdr(inputLLH, ellps, orbit, dop,
+                        a, r, radarGrid.wavelength(), 1e-4, 100, 1e-4);
+                const float azpix = (a - start) / pixazm;
+                const float ranpix = (r - r0) / dr;
+
+                // Establish bounds for bilinear weighting model
+                const float x1 = std::floor(ranpix);
+                const float x2 = x1 + 1.0;
+                const float y1 = std::floor(azpix);
+                const float y2 = y1 + 1.0;
+
+                // Check to see if pixel lies in valid RDC range
+                if (ranpix < 0.0 or x2 > xbound or azpix < 0.0 or y2 > ybound)
+                    continue;
+
+                // XYZ corner vectors of facets inside the radar grid
+                const Vec3& xyz00 = top.corner(2 * jj, demX0[jj], dem_interp, proj, ellps);
+                const Vec3& xyz10 = top.corner(slotX1[jj], demX1[jj], dem_interp, proj, ellps);
+                const Vec3& xyz01 = bottom.corner(2 * jj, demX0[jj], dem_interp, proj, ellps);
+                const Vec3& xyz11 = bottom.corner(slotX1[jj], demX1[jj], dem_interp, proj, ellps);
+
+                // Compute normal vectors for each facet
+                const Vec3 normalFacet1 = normalPlane(xyz00, xyz10, xyz01);
+                const Vec3 normalFacet2 = normalPlane(xyz01, xyz10, xyz11);
+
+                // Side lengths
+                const double p00_01 = (xyz00 - xyz01).norm();
+                const double p00_10 = (xyz00 - xyz10).norm();
+                const double p10_01 = (xyz10 - xyz01).norm();
+                const double p11_01 = (xyz11 - xyz01).norm();
+                const double p11_10 = (xyz11 - xyz10).norm();
+
+                // Semi-perimeters
+                const float h1 = 0.5 * (p00_01 + p00_10 + p10_01);
+                const float h2 = 0.5 * (p11_01 + p11_10 + p10_01);
+
+                // Heron's formula to get area of facets in XYZ coordinates
+                const float AP1 = std::sqrt(h1 * (h1 - p00_01) * (h1 - p00_10) * (h1 - p10_01));
+                const float AP2 = std::sqrt(h2 * (h2 - p11_01) * (h2 - p11_10) * (h2 - p10_01));
+
+                // Compute look angle from sensor to ground
+                const Vec3 xyz_mid = ellps.lonLatToXyz(inputLLH);
+                isce::core::cartesian_t xyz_plat, vel;
+                orbit.interpolateWGS84Orbit(a, xyz_plat, vel);
+                const Vec3 lookXYZ = (xyz_plat - xyz_mid).unitVec();
+
+                // Compute dot product between each facet and look vector
+                const double cosIncFacet1 = lookXYZ.dot(normalFacet1);
+                const double cosIncFacet2 = lookXYZ.dot(normalFacet2);
+                // If facets are not illuminated by radar, skip
+                if (cosIncFacet1 < 0. or cosIncFacet2 < 0.) {
+                    continue;
+                }
+
+                // Compute projected area
+                const float area = AP1 * cosIncFacet1 + AP2 * cosIncFacet2;
+
+                // Get integer indices of bounds
+                const int ix1 = static_cast<int>(x1);
+                const int ix2 = static_cast<int>(x2);
+                const int iy1 = static_cast<int>(y1);
+                const int iy2 = static_cast<int>(y2);
+
+                // Compute fractional weights from indices
+                const float Wr = ranpix - x1;
+                const float Wa = azpix - y1;
+                const float Wrc = 1. - Wr;
+                const float Wac = 1. - Wa;
+
+                // Use bilinear weighting to distribute area
+                #pragma omp atomic
+                out[radarGrid.width() * iy1 + ix1] += area * Wrc * Wac;
+                #pragma omp atomic
+                out[radarGrid.width() * iy1 + ix2] += area * Wr * Wac;
+                #pragma omp atomic
+                out[radarGrid.width() * iy2 + ix1] += area * Wrc * Wa;
+                #pragma omp atomic
+                out[radarGrid.width() * iy2 + ix2] += area * Wr * Wa;
+            }
         }
     }
 
@@ -255,37 +313,17 @@ void isce::geometry::facetRTC(const isce::product::RadarGridParameters& radarGri
     float max_hgt, avg_hgt;
     pyre::journal::info_t info("facet_calib");
     dem_interp.computeHeightStats(max_hgt, avg_hgt, info);
-    isce::geometry::DEMInterpolator flat_interp(avg_hgt);
+
+    // Flat-earth incidence angles on a coarse range grid, one orbit state per line
+    const isce::geometry::IncidenceAngleTable incTable(start, pixazm, radarGrid.length(),
+                                                       r0, dr, radarGrid.width(),
+                                                       orbit, ellps, lookSide, avg_hgt);
 
     // Compute the flat earth incidence angle correction applied by UAVSAR processing
-    #pragma omp parallel for schedule(dynamic) collapse(2)
+    #pragma omp parallel for schedule(dynamic)
     for (size_t i = 0; i < radarGrid.length(); ++i) {
         for (size_t j = 0; j < radarGrid.width(); ++j) {
-
-            isce::core::cartesian_t xyz_plat, vel;
-            orbit.interpolateWGS84Orbit(start + i * pixazm, xyz_plat, vel);
-
-            // Slant range for current pixel
-            const double slt_range = r0 + j * dr;
-
-            // Get LLH and XYZ coordinates for this azimuth/range
-            isce::core::cartesian_t targetLLH, targetXYZ;
-            targetLLH[2] = avg_hgt; // initialize first guess
-            isce::geometry::rdr2geo(start + i * pixazm, slt_range, 0, orbit, ellps,
-                    flat_interp, targetLLH, radarGrid.wavelength(), lookSide,
-                    1e-4, 20, 20, isce::core::HERMITE_METHOD);
-
-            // Computation of ENU coordinates around ground target
-            ellps.lonLatToXyz(targetLLH, targetXYZ);
-            const Vec3 satToGround = targetXYZ - xyz_plat;
-            const Mat3 xyz2enu = Mat3::xyzToEnu(targetLLH[1], targetLLH[0]);
-            const Vec3 enu = xyz2enu.dot(satToGround);
-
-            // Compute incidence angle components
-            const double costheta = std::abs(enu[2]) / enu.norm();
-            const double sintheta = std::sqrt(1. - costheta*costheta);
-
-            out[radarGrid.width() * i + j] *= sintheta;
+            out[radarGrid.width() * i + j] *= incTable.sinIncidence(i, j);
         }
     }
     std::cout << std::endl;
@@ -0,0 +1,135 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#include <algorithm>
+
+// isce::core
+#include <isce/core/Basis.h>
+#include <isce/core/Pixel.h>
+
+// isce::except
+#include <isce/except/Error.h>
+
+// isce::geometry
+#include "DEMInterpolator.h"
+#include "geometry.h"
+#include "RadarGridCube.h"
+
+using isce::core::Basis;
+using isce::core::Pixel;
+using isce::core::Vec3;
+
+/** @param[in] radarGrid RadarGridParameters defining lines and range bins
+  * @param[in] heights Heights above ellipsoid of cube slices (increasing)
+  * @param[in] azimuthDecimation Lines between coarse grid nodes
+  * @param[in] rangeDecimation Range bins between coarse grid nodes */
+isce::geometry::RadarGridCube::
+RadarGridCube(const isce::product::RadarGridParameters & radarGrid,
+              const std::vector<double> & heights,
+              size_t azimuthDecimation,
+              size_t rangeDecimation) :
+    RadarGridCube(radarGrid.sensingStart(),
+                  radarGrid.numberAzimuthLooks() / radarGrid.prf(),
+                  radarGrid.length(),
+                  radarGrid.startingRange(),
+                  radarGrid.numberRangeLooks() * radarGrid.rangePixelSpacing(),
+                  radarGrid.width(),
+                  heights, azimuthDecimation, rangeDecimation) {}
+
+/** @param[in] azimuthStart Azimuth time of first line
+  * @param[in] azimuthSpacing Azimuth time between lines
+  * @param[in] length Number of lines
+  * @param[in] startingRange Slant range of first range bin
+  * @param[in] rangeSpacing Slant range between range bins
+  * @param[in] width Number of range bins
+  * @param[in] heights Heights above ellipsoid of cube slices (increasing)
+  * @param[in] azimuthDecimation Lines between coarse grid nodes
+  * @param[in] rangeDecimation Range bins between coarse grid nodes */
+isce::geometry::RadarGridCube::
+RadarGridCube(double azimuthStart, double azimuthSpacing, size_t length,
+              double startingRange, double rangeSpacing, size_t width,
+              const std::vector<double> & heights,
+              size_t azimuthDecimation,
+              size_t rangeDecimation) :
+    _azimuthStart(azimuthStart),
+    _azimuthSpacing(azimuthSpacing),
+    _length(length),
+    _startingRange(startingRange),
+    _rangeSpacing(rangeSpacing),
+    _width(width),
+    _heights(heights),
+    _azimuthDecimation(std::max(azimuthDecimation, (size_t) 1)),
+    _rangeDecimation(std::max(rangeDecimation, (size_t) 1)) {
+
+    if (_heights.empty()) {
+        throw isce::except::LengthError(ISCE_SRCINFO(),
+            "radar grid cube requires at least one height");
+    }
+    for (size_t k = 1; k < _heights.size(); ++k) {
+        if (_heights[k] <= _heights[k-1]) {
+            throw isce::except::InvalidArgument(ISCE_SRCINFO(),
+                "radar grid cube heights must be strictly increasing");
+        }
+    }
+
+    // Coarse nodes covering [0, length - 1] and [0, width - 1]
+    _coarseLength = (std::max(_length, (size_t) 2) - 2) / _azimuthDecimation + 2;
+    _coarseWidth = (std::max(_width, (size_t) 2) - 2) / _rangeDecimation + 2;
+}
+
+/** @param[in] orbit Orbit object
+  * @param[in] ellipsoid Ellipsoid object
+  * @param[in] lookSide +1 for left and -1 for right
+  * @param[in] orbitMethod Orbit interpolation method */
+void isce::geometry::RadarGridCube::
+_computeTargets(const isce::core::Orbit & orbit,
+                const isce::core::Ellipsoid & ellipsoid,
+                int lookSide,
+                isce::core::orbitInterpMethod orbitMethod) {
+
+    const size_t nheights = _heights.size();
+    const size_t nnodes = nheights * _coarseLength * _coarseWidth;
+    _platformPositions.resize(3 * _coarseLength);
+    _platformVelocities.resize(3 * _coarseLength);
+    _targetsLLH.resize(3 * nnodes);
+    _targetsXYZ.resize(3 * nnodes);
+
+    #pragma omp parallel for schedule(dynamic)
+    for (size_t row = 0; row < _coarseLength; ++row) {
+
+        // Platform state for this line is interpolated once
+        Vec3 pos, vel;
+        orbit.interpolate(coarseAzimuthTime(row), pos, vel, orbitMethod);
+        const Basis TCNbasis(pos, vel);
+        for (int i = 0; i < 3; ++i) {
+            _platformPositions[3*row + i] = pos[i];
+            _platformVelocities[3*row + i] = vel[i];
+        }
+
+        for (size_t k = 0; k < nheights; ++k) {
+
+            // Constant height DEM for this slice
+            const DEMInterpolator flatInterp(_heights[k]);
+
+            for (size_t col = 0; col < _coarseWidth; ++col) {
+
+                // Target on constant height surface (zero Doppler)
+                const Pixel pixel(coarseSlantRange(col), 0.0, col);
+                isce::core::cartesian_t targetLLH{0.0, 0.0, _heights[k]};
+                rdr2geo(pixel, TCNbasis, pos, vel, ellipsoid, flatInterp, targetLLH,
+                        lookSide, 1.0e-4, 20, 20);
+
+                const Vec3 targetXYZ = ellipsoid.lonLatToXyz(targetLLH);
+                const size_t offset = _nodeOffset(k, row, col);
+                for (int i = 0; i < 3; ++i) {
+                    _targetsLLH[offset + i] = targetLLH[i];
+                    _targetsXYZ[offset + i] = targetXYZ[i];
+                }
+            }
+        }
+    }
+}
+
+// end of file
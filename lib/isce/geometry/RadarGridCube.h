@@ -0,0 +1,180 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+
+#ifndef ISCE_GEOMETRY_RADARGRIDCUBE_H
+#define ISCE_GEOMETRY_RADARGRIDCUBE_H
+
+#include <algorithm>
+#include <vector>
+
+// isce::core
+#include <isce/core/Constants.h>
+#include <isce/core/Ellipsoid.h>
+#include <isce/core/Orbit.h>
+
+// isce::product
+#include <isce/product/RadarGridParameters.h>
+
+// Declaration
+namespace isce {
+    namespace geometry {
+        class RadarGridCube;
+    }
+}
+
+/** Coarse azimuth x range x height grid over a radar image.
+ *
+ * Holds the radar sampling, the decimated nodes covering [0, length - 1] lines
+ * and [0, width - 1] range bins, and a set of strictly increasing heights above
+ * the ellipsoid. Derived products (geometry layers, baselines) solve zero-Doppler
+ * ground targets on this grid once with _computeTargets(), interpolating the orbit
+ * once per coarse line. */
+class isce::geometry::RadarGridCube {
+
+    public:
+        /** Default constructor */
+        RadarGridCube() {}
+
+        /** Constructor from radar grid */
+        RadarGridCube(const isce::product::RadarGridParameters & radarGrid,
+                      const std::vector<double> & heights,
+                      size_t azimuthDecimation,
+                      size_t rangeDecimation);
+
+        /** Constructor from explicit azimuth and range sampling */
+        RadarGridCube(double azimuthStart, double azimuthSpacing, size_t length,
+                      double startingRange, double rangeSpacing, size_t width,
+                      const std::vector<double> & heights,
+                      size_t azimuthDecimation,
+                      size_t rangeDecimation);
+
+        /** Number of lines covered by grid */
+        inline size_t length() const { return _length; }
+
+        /** Number of range bins covered by grid */
+        inline size_t width() const { return _width; }
+
+        /** Azimuth decimation factor of coarse grid */
+        inline size_t azimuthDecimation() const { return _azimuthDecimation; }
+
+        /** Range decimation factor of coarse grid */
+        inline size_t rangeDecimation() const { return _rangeDecimation; }
+
+        /** Number of coarse azimuth nodes */
+        inline size_t coarseLength() const { return _coarseLength; }
+
+        /** Number of coarse range nodes */
+        inline size_t coarseWidth() const { return _coarseWidth; }
+
+        /** Azimuth time of first line */
+        inline double azimuthStart() const { return _azimuthStart; }
+
+        /** Azimuth time between lines */
+        inline double azimuthSpacing() const { return _azimuthSpacing; }
+
+        /** Slant range of first range bin */
+        inline double startingRange() const { return _startingRange; }
+
+        /** Slant range between range bins */
+        inline double rangeSpacing() const { return _rangeSpacing; }
+
+        /** Azimuth time of coarse node */
+        inline double coarseAzimuthTime(size_t row) const {
+            return _azimuthStart + row * _azimuthDecimation * _azimuthSpacing;
+        }
+
+        /** Slant range of coarse node */
+        inline double coarseSlantRange(size_t col) const {
+            return _startingRange + col * _rangeDecimation * _rangeSpacing;
+        }
+
+        /** Heights above ellipsoid of cube slices */
+        inline const std::vector<double> & heights() const { return _heights; }
+
+    protected:
+        /** Solve zero-Doppler ground targets at every node and height */
+        void _computeTargets(const isce::core::Orbit & orbit,
+                             const isce::core::Ellipsoid & ellipsoid,
+                             int lookSide,
+                             isce::core::orbitInterpMethod orbitMethod);
+
+        /** Platform position at coarse line (valid after _computeTargets) */
+        inline const double * _platformPosition(size_t row) const {
+            return &_platformPositions[3 * row];
+        }
+
+        /** Platform velocity at coarse line (valid after _computeTargets) */
+        inline const double * _platformVelocity(size_t row) const {
+            return &_platformVelocities[3 * row];
+        }
+
+        /** Target longitude, latitude (radians) and height of a node */
+        inline const double * _targetLLH(size_t k, size_t row, size_t col) const {
+            return &_targetsLLH[_nodeOffset(k, row, col)];
+        }
+
+        /** Target ECEF coordinates of a node */
+        inline const double * _targetXYZ(size_t k, size_t row, size_t col) const {
+            return &_targetsXYZ[_nodeOffset(k, row, col)];
+        }
+
+        /** Check if ground targets have been computed */
+        inline bool _haveTargets() const { return !_targetsXYZ.empty(); }
+
+        /** Bracketing slice and weight of a height */
+        inline void _heightIndex(double height, size_t & k, double & w) const;
+
+    private:
+        inline size_t _nodeOffset(size_t k, size_t row, size_t col) const {
+            return 3 * ((k * _coarseLength + row) * _coarseWidth + col);
+        }
+
+    private:
+        // Azimuth sampling
+        double _azimuthStart = 0.0;
+        double _azimuthSpacing = 1.0;
+        size_t _length = 0;
+
+        // Range sampling
+        double _startingRange = 0.0;
+        double _rangeSpacing = 1.0;
+        size_t _width = 0;
+
+        // Heights, decimation and coarse grid size
+        std::vector<double> _heights;
+        size_t _azimuthDecimation = 1;
+        size_t _rangeDecimation = 1;
+        size_t _coarseLength = 0;
+        size_t _coarseWidth = 0;
+
+        // Platform state per coarse line and ground targets
+        // (height x coarse line x coarse range bin, components interleaved)
+        std::vector<double> _platformPositions;
+        std::vector<double> _platformVelocities;
+        std::vector<double> _targetsLLH;
+        std::vector<double> _targetsXYZ;
+};
+
+/** @param[in] height Height above ellipsoid
+  * @param[out] k Index of lower slice of bracket
+  * @param[out] w Weight of upper slice (clamped to [0, 1]) */
+inline void isce::geometry::RadarGridCube::
+_heightIndex(double height, size_t & k, double & w) const {
+    const size_t n = _heights.size();
+    k = 0;
+    w = 0.0;
+    if (n < 2) {
+        return;
+    }
+    while (k < n - 2 && height > _heights[k+1]) {
+        ++k;
+    }
+    w = (height - _heights[k]) / (_heights[k+1] - _heights[k]);
+    w = std::min(std::max(w, 0.0), 1.0);
+}
+
+#endif
+
+// end of file
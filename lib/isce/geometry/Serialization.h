@@ -12,8 +12,15 @@
 #include <cereal/types/memory.hpp>
 #include <cereal/archives/xml.hpp>
 
+#include <isce/io/IH5.h>
+#include <isce/io/Serialization.h>
+
+#include <isce/geometry/BaselineGrid.h>
+#include <isce/geometry/GeometryCube.h>
+#include <isce/geometry/RadarGridCube.h>
 #include <isce/geometry/Topo.h>
 #include <isce/geometry/Geo2rdr.h>
+#include <isce/geometry/GeocodeLookupTable.h>
 
 namespace isce {
     namespace geometry {
@@ -87,6 +94,191 @@ namespace isce {
             geo.orbitMethod(orbitMethod);
         }
 
+        // ----------------------------------------------------------------------
+        // Serialization for GeocodeLookupTable
+        // ----------------------------------------------------------------------
+
+        /** Load GeocodeLookupTable from HDF5.
+         *
+         * @param[in] group         HDF5 group object.
+         * @param[in] lookupTable   GeocodeLookupTable object to be configured. */
+        inline void loadFromH5(isce::io::IGroup & group, GeocodeLookupTable & lookupTable) {
+
+            // Geocoded grid geometry
+            std::vector<double> grid;
+            std::vector<int> shape;
+            isce::io::loadFromH5(group, "geoGrid", grid);
+            isce::io::loadFromH5(group, "shape", shape);
+
+            // Allocate table and load radar coordinates
+            lookupTable = GeocodeLookupTable(grid[0], grid[1], grid[2], grid[3],
+                                             shape[0], shape[1], shape[2], shape[3]);
+            isce::io::loadFromH5(group, "radarLine", lookupTable.radarLine());
+            isce::io::loadFromH5(group, "radarPixel", lookupTable.radarPixel());
+        }
+
+        /** Save GeocodeLookupTable to HDF5.
+         *
+         * @param[in] group         HDF5 group object.
+         * @param[in] lookupTable   GeocodeLookupTable object to be saved. */
+        inline void saveToH5(isce::io::IGroup & group, const GeocodeLookupTable & lookupTable) {
+
+            // Geocoded grid: top-left corner and spacing
+            std::vector<double> grid{lookupTable.geoGridStartX(), lookupTable.geoGridStartY(),
+                                     lookupTable.geoGridSpacingX(),
+                                     lookupTable.geoGridSpacingY()};
+            isce::io::saveToH5(group, "geoGrid", grid);
+
+            // Width, length, EPSG code, and decimation
+            std::vector<int> shape{static_cast<int>(lookupTable.width()),
+                                   static_cast<int>(lookupTable.length()),
+                                   lookupTable.epsg(),
+                                   static_cast<int>(lookupTable.decimation())};
+            isce::io::saveToH5(group, "shape", shape);
+
+            // Radar coordinates on the stored grid
+            isce::io::saveToH5(group, "radarLine", lookupTable.radarLine(), "radar lines");
+            isce::io::saveToH5(group, "radarPixel", lookupTable.radarPixel(), "radar pixels");
+        }
+
+        // ----------------------------------------------------------------------
+        // Serialization for RadarGridCube (shared by BaselineGrid, GeometryCube)
+        // ----------------------------------------------------------------------
+
+        /** Load sampling of a RadarGridCube from HDF5.
+         *
+         * @param[in] group         HDF5 group object.
+         * @param[out] grid         First line time, line spacing, starting range,
+         *                          range spacing.
+         * @param[out] shape        Length, width, azimuth and range decimation,
+         *                          followed by any entries of the derived product.
+         * @param[out] heights      Heights above ellipsoid of cube slices. */
+        inline void loadRadarGridCube(isce::io::IGroup & group, std::vector<double> & grid,
+                                      std::vector<int> & shape,
+                                      std::vector<double> & heights) {
+            isce::io::loadFromH5(group, "radarGrid", grid);
+            isce::io::loadFromH5(group, "shape", shape);
+            isce::io::loadFromH5(group, "heightAboveEllipsoid", heights);
+        }
+
+        /** Save sampling and axes of a RadarGridCube to HDF5.
+         *
+         * @param[in] group         HDF5 group object.
+         * @param[in] cube          RadarGridCube object to be saved.
+         * @param[in] extraShape    Entries appended to the shape dataset. */
+        inline void saveRadarGridCube(isce::io::IGroup & group, const RadarGridCube & cube,
+                                      const std::vector<int> & extraShape = {}) {
+
+            // Radar grid: first line time, line spacing, starting range, range spacing
+            std::vector<double> grid{cube.azimuthStart(), cube.azimuthSpacing(),
+                                     cube.startingRange(), cube.rangeSpacing()};
+            isce::io::saveToH5(group, "radarGrid", grid);
+
+            // Length, width, azimuth and range decimation
+            std::vector<int> shape{static_cast<int>(cube.length()),
+                                   static_cast<int>(cube.width()),
+                                   static_cast<int>(cube.azimuthDecimation()),
+                                   static_cast<int>(cube.rangeDecimation())};
+            shape.insert(shape.end(), extraShape.begin(), extraShape.end());
+            isce::io::saveToH5(group, "shape", shape);
+
+            // Cube axes
+            std::vector<double> aztime(cube.coarseLength());
+            for (size_t row = 0; row < aztime.size(); ++row) {
+                aztime[row] = cube.coarseAzimuthTime(row);
+            }
+            std::vector<double> slantRange(cube.coarseWidth());
+            for (size_t col = 0; col < slantRange.size(); ++col) {
+                slantRange[col] = cube.coarseSlantRange(col);
+            }
+            isce::io::saveToH5(group, "zeroDopplerTime", aztime, "seconds");
+            isce::io::saveToH5(group, "slantRange", slantRange, "meters");
+            isce::io::saveToH5(group, "heightAboveEllipsoid", cube.heights(), "meters");
+        }
+
+        // ----------------------------------------------------------------------
+        // Serialization for BaselineGrid
+        // ----------------------------------------------------------------------
+
+        /** Load BaselineGrid from HDF5.
+         *
+         * @param[in] group         HDF5 group object.
+         * @param[in] baselineGrid  BaselineGrid object to be configured. */
+        inline void loadFromH5(isce::io::IGroup & group, BaselineGrid & baselineGrid) {
+
+            // Radar grid sampling, shape and heights
+            std::vector<double> grid, heights;
+            std::vector<int> shape;
+            loadRadarGridCube(group, grid, shape, heights);
+
+            // Allocate cubes and load baselines
+            baselineGrid = BaselineGrid(grid[0], grid[1], shape[0], grid[2], grid[3],
+                                        shape[1], heights, shape[2], shape[3]);
+            isce::io::loadFromH5(group, "perpendicularBaseline",
+                                 baselineGrid.perpendicularBaseline());
+            isce::io::loadFromH5(group, "parallelBaseline",
+                                 baselineGrid.parallelBaseline());
+        }
+
+        /** Save BaselineGrid to HDF5.
+         *
+         * @param[in] group         HDF5 group object.
+         * @param[in] baselineGrid  BaselineGrid object to be saved. */
+        inline void saveToH5(isce::io::IGroup & group, const BaselineGrid & baselineGrid) {
+
+            // Radar grid sampling and cube axes
+            saveRadarGridCube(group, baselineGrid);
+
+            // Baselines on the coarse grid
+            isce::io::saveToH5(group, "perpendicularBaseline",
+                               baselineGrid.perpendicularBaseline(), "meters");
+            isce::io::saveToH5(group, "parallelBaseline",
+                               baselineGrid.parallelBaseline(), "meters");
+        }
+
+        // ----------------------------------------------------------------------
+        // Serialization for GeometryCube
+        // ----------------------------------------------------------------------
+
+        /** Load GeometryCube from HDF5.
+         *
+         * @param[in] group         HDF5 group object.
+         * @param[in] geometryCube  GeometryCube object to be configured. */
+        inline void loadFromH5(isce::io::IGroup & group, GeometryCube & geometryCube) {
+
+            // Radar grid sampling, shape (with EPSG code) and heights
+            std::vector<double> grid, heights;
+            std::vector<int> shape;
+            loadRadarGridCube(group, grid, shape, heights);
+
+            // Allocate cubes and load layers
+            geometryCube = GeometryCube(grid[0], grid[1], shape[0], grid[2], grid[3],
+                                        shape[1], heights, shape[2], shape[3], shape[4]);
+            for (int i = 0; i < CUBE_NLAYERS; ++i) {
+                const geometryCubeLayer layer = static_cast<geometryCubeLayer>(i);
+                isce::io::loadFromH5(group, GeometryCube::layerName(layer),
+                                     geometryCube.layer(layer));
+            }
+        }
+
+        /** Save GeometryCube to HDF5.
+         *
+         * @param[in] group         HDF5 group object.
+         * @param[in] geometryCube  GeometryCube object to be saved. */
+        inline void saveToH5(isce::io::IGroup & group, const GeometryCube & geometryCube) {
+
+            // Radar grid sampling and cube axes; EPSG code of x/y follows the shape
+            saveRadarGridCube(group, geometryCube, {geometryCube.epsg()});
+
+            // Layers on the coarse grid
+            const std::string units[CUBE_NLAYERS] = {"", "", "degrees", "degrees", "", "", ""};
+            for (int i = 0; i < CUBE_NLAYERS; ++i) {
+                const geometryCubeLayer layer = static_cast<geometryCubeLayer>(i);
+                isce::io::saveToH5(group, GeometryCube::layerName(layer),
+                                   geometryCube.layer(layer), units[i]);
+            }
+        }
+
     }
 }
 
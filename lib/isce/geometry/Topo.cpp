@@ -13,11 +13,15 @@
 #include <vector>
 #include <valarray>
 #include <algorithm>
+#include <utility>
 
 // isce::core
 #include <isce/core/Constants.h>
 #include <isce/core/Utilities.h>
 
+// isce::except
+#include <isce/except/Error.h>
+
 // isce::geometry
 #include "Topo.h"
 
@@ -42,7 +46,10 @@ using isce::io::Raster;
   * <li> localInc.rdr - Local incidence angle (degrees) at target
   * <li> locaPsi.rdr - Local projection angle (degrees) at target
   * <li> simamp.rdr - Simulated amplitude image.
-  * </ul>*/
+  * </ul>
+  * Only layers selected with outputLayers() are created and added to topo.vrt.
+  * Geo2rdr reads x/y/z from the first three bands of topo.vrt, so it is only
+  * written when x, y and z are all selected.*/
 void isce::geometry::Topo::
 topo(Raster & demRaster,
      const std::string outdir) {
@@ -51,6 +58,8 @@ topo(Raster & demRaster,
 
     // Initialize a TopoLayers object to handle block data and raster data
     TopoLayers layers;
+    layers.selection(_outputLayers);
+    layers.singlePrecisionXY(_singlePrecisionXY);
 
     // Create rasters for individual layers (provide output raster sizes)
     layers.initRasters(outdir, _radarGrid.width(), _radarGrid.length(),
@@ -61,22 +70,46 @@ topo(Raster & demRaster,
 
     } // end Topo scope to release raster resources
 
-    // Write out multi-band topo VRT
-    std::vector<Raster> rasterTopoVec = {
-        Raster(outdir + "/x.rdr" ),
-        Raster(outdir + "/y.rdr" ),
-        Raster(outdir + "/z.rdr" ),
-        Raster(outdir + "/inc.rdr" ),
-        Raster(outdir + "/hdg.rdr" ),
-        Raster(outdir + "/localInc.rdr" ),
-        Raster(outdir + "/localPsi.rdr" ),
-        Raster(outdir + "/simamp.rdr" )
+    // Write out multi-band topo VRT from the selected layers
+    _writeTopoVRT(outdir, _outputLayers);
+}
+
+/** @param[in] outdir directory containing topo layers
+  * @param[in] selection layers to collect (bitwise OR of topoLayer flags)
+  *
+  * Bands 1-3 of topo.vrt are always x, y and z, which is what Geo2rdr reads.
+  * Selections without all three are not collected. */
+void isce::geometry::Topo::
+_writeTopoVRT(const std::string & outdir, int selection) {
+
+    // Without x/y/z the remaining layers would shift into bands 1-3
+    if ((selection & TOPO_XYZ) != TOPO_XYZ) {
+        if (selection != 0) {
+            pyre::journal::warning_t warning("isce.geometry.Topo");
+            warning << pyre::journal::at(__HERE__)
+                    << "topo.vrt not written: x, y and z layers are required"
+                    << pyre::journal::endl;
+        }
+        return;
+    }
+
+    const std::vector<std::pair<int, std::string>> layerFiles = {
+        {TOPO_X, "x.rdr"}, {TOPO_Y, "y.rdr"}, {TOPO_Z, "z.rdr"},
+        {TOPO_INC, "inc.rdr"}, {TOPO_HDG, "hdg.rdr"},
+        {TOPO_LOCALINC, "localInc.rdr"}, {TOPO_LOCALPSI, "localPsi.rdr"},
+        {TOPO_SIM, "simamp.rdr"}
     };
+    std::vector<Raster> rasterTopoVec;
+    for (const auto & layerFile : layerFiles) {
+        if ((selection & layerFile.first) == layerFile.first) {
+            rasterTopoVec.push_back(Raster(outdir + "/" + layerFile.second));
+        }
+    }
 
     // Add optional mask raster
-    if (_computeMask) {
+    if (_computeMask && ((selection & TOPO_MASK) == TOPO_MASK)) {
         rasterTopoVec.push_back(Raster(outdir + "/mask.rdr" ));
-    };
+    }
 
     Raster vrt = Raster(outdir + "/topo.vrt", rasterTopoVec );
     // Set its EPSG code
@@ -151,6 +184,89 @@ topo(Raster & demRaster, Raster & xRaster, Raster & yRaster, Raster & heightRast
   */
 void isce::geometry::Topo::
 topo(Raster & demRaster, TopoLayers & layers) {
+    _topo(demRaster, layers, nullptr, nullptr, nullptr, 0.0, 0.0);
+}
+
+/** @param[in] demRaster input DEM raster
+  * @param[in] secondary Geo2rdr object of the secondary acquisition
+  * @param[in] outdir directory to write outputs to
+  * @param[in] topoLayers topo layers to write in addition to the offsets (bitwise OR
+               of topoLayer flags); none by default
+  * @param[in] azshift Number of lines to shift by in azimuth
+  * @param[in] rgshift Number of pixels to shift by in range
+  *
+  * Reference-to-secondary offset driver. The target coordinates of every block are
+  * passed in memory to geo2rdr of the secondary, so x/y/z never need to be written
+  * and read back. The offset file names are the ones used by Geo2rdr::geo2rdr
+  * <ul>
+  * <li>azimuth.off - Azimuth offset to be applied to secondary to align with reference
+  * <li>range.off - Range offset to be applied to secondary to align with reference
+  * </ul>
+  * Requested topo layers (restricted to those selected with outputLayers()) are
+  * written with their usual names and collected in topo.vrt when they include
+  * x, y and z.*/
+void isce::geometry::Topo::
+topo(Raster & demRaster, const Geo2rdr & secondary, const std::string & outdir,
+     int topoLayers, double azshift, double rgshift) {
+
+    const int selection = topoLayers & _outputLayers;
+
+    { // Topo scope for creating output rasters
+
+    // Initialize a TopoLayers object with only the requested layers
+    TopoLayers layers;
+    layers.selection(selection);
+    layers.singlePrecisionXY(_singlePrecisionXY);
+    layers.initRasters(outdir, _radarGrid.width(), _radarGrid.length(),
+                       _computeMask);
+
+    // Create offset rasters on the reference radar grid
+    Raster rgoffRaster = Raster(outdir + "/range.off", _radarGrid.width(),
+        _radarGrid.length(), 1, GDT_Float32, "ISCE");
+    Raster azoffRaster = Raster(outdir + "/azimuth.off", _radarGrid.width(),
+        _radarGrid.length(), 1, GDT_Float32, "ISCE");
+
+    // Call fused topo with layers
+    topo(demRaster, layers, secondary, rgoffRaster, azoffRaster, azshift, rgshift);
+
+    } // end Topo scope to release raster resources
+
+    // Write out multi-band topo VRT from the requested layers
+    _writeTopoVRT(outdir, selection);
+}
+
+/** @param[in] demRaster input DEM raster
+  * @param[in] layers TopoLayers object for storing and writing selected topo layers
+  * @param[in] secondary Geo2rdr object of the secondary acquisition
+  * @param[in] rgoffRaster range offset output on the reference radar grid
+  * @param[in] azoffRaster azimuth offset output on the reference radar grid
+  * @param[in] azshift Number of lines to shift by in azimuth
+  * @param[in] rgshift Number of pixels to shift by in range */
+void isce::geometry::Topo::
+topo(Raster & demRaster, TopoLayers & layers, const Geo2rdr & secondary,
+     Raster & rgoffRaster, Raster & azoffRaster, double azshift, double rgshift) {
+
+    // Offsets are computed for every pixel of the reference radar grid
+    for (Raster * raster : {&rgoffRaster, &azoffRaster}) {
+        if ((raster->width() != _radarGrid.width()) ||
+            (raster->length() != _radarGrid.length())) {
+            throw isce::except::LengthError(ISCE_SRCINFO(),
+                "Offset rasters must match the size of the reference radar grid");
+        }
+    }
+    _topo(demRaster, layers, &secondary, &rgoffRaster, &azoffRaster, azshift, rgshift);
+}
+
+/** @param[in] demRaster input DEM raster
+  * @param[in] layers TopoLayers object for storing and writing results
+  * @param[in] secondary Geo2rdr object of the secondary (nullptr for topo only)
+  * @param[in] rgoffRaster range offset output (unused for topo only)
+  * @param[in] azoffRaster azimuth offset output (unused for topo only)
+  * @param[in] azshift Number of lines to shift by in azimuth
+  * @param[in] rgshift Number of pixels to shift by in range */
+void isce::geometry::Topo::
+_topo(Raster & demRaster, TopoLayers & layers, const Geo2rdr * secondary,
+      Raster * rgoffRaster, Raster * azoffRaster, double azshift, double rgshift) {
 
     // Create reusable pyre::journal channels
     pyre::journal::warning_t warning("isce.geometry.Topo");
@@ -159,8 +275,26 @@ topo(Raster & demRaster, TopoLayers & layers) {
     // Create and start a timer
     auto timerStart = std::chrono::steady_clock::now();
 
-    // Create a DEM interpolator
+    // Restrict computation to the requested layers and their dependencies
+    int selection = layers.selection() & _outputLayers;
+    const bool computeMask = _computeMask && ((selection & TOPO_MASK) == TOPO_MASK);
+    if (computeMask) {
+        // Layover/shadow masks are derived from x, y, and incidence angle
+        selection |= TOPO_X | TOPO_Y | TOPO_INC;
+    } else {
+        selection &= ~TOPO_MASK;
+    }
+    layers.selection(selection);
+    if (_singlePrecisionXY) {
+        layers.singlePrecisionXY(true);
+    }
+
+    // Create a DEM interpolator; slopes are only needed for local angles, and
+    // gradient grids are only used for bilinear DEM interpolation
     DEMInterpolator demInterp(-500.0, _demMethod);
+    demInterp.computeGradients(layers.hasLayer(TOPO_LOCALINC) ||
+                               layers.hasLayer(TOPO_LOCALPSI) ||
+                               layers.hasLayer(TOPO_SIM));
 
     // Compute number of blocks needed to process image
     size_t nBlocks = _radarGrid.length() / _linesPerBlock;
@@ -172,8 +306,13 @@ topo(Raster & demRaster, TopoLayers & layers) {
     const double endingRange = _radarGrid.endingRange();
     const double midRange = _radarGrid.midRange();
 
+    // Target coordinates of a line and offsets of a block for the secondary
+    const size_t width = _radarGrid.width();
+    std::valarray<double> llhLine(secondary ? 3 * width : 0);
+    std::valarray<float> rgoff, azoff;
+
     // Loop over blocks
-    size_t totalconv = 0;
+    size_t totalconv = 0, offsetconv = 0;
     for (size_t block = 0; block < nBlocks; ++block) {
 
         // Get block extents
@@ -207,10 +346,20 @@ topo(Raster & demRaster, TopoLayers & layers) {
 
         // Set output block sizes in layers
         layers.setBlockSize(blockLength, _radarGrid.width());
+        if (secondary) {
+            rgoff.resize(blockLength * width);
+            azoff.resize(blockLength * width);
+        }
 
         // Allocate vector for storing satellite position for each line
         std::vector<cartesian_t> satPosition(blockLength);
 
+        // Slant ranges of the block and Doppler along a line
+        std::valarray<double> slantRanges(_radarGrid.width()), dopplers(_radarGrid.width());
+        for (size_t rbin = 0; rbin < _radarGrid.width(); ++rbin) {
+            slantRanges[rbin] = _radarGrid.slantRange(rbin);
+        }
+
         // For each line in block
         double tline;
         for (size_t blockLine = 0; blockLine < blockLength; ++blockLine) {
@@ -227,16 +376,19 @@ topo(Raster & demRaster, TopoLayers & layers) {
             // Compute velocity magnitude
             const double satVmag = vel.norm();
 
+            // Evaluate Doppler for the whole line
+            _doppler.evalBatch(tline, &slantRanges[0], _radarGrid.width(), &dopplers[0]);
+
             // For each slant range bin
             #pragma omp parallel for reduction(+:totalconv)
             for (size_t rbin = 0; rbin < _radarGrid.width(); ++rbin) {
 
                 // Get current slant range
-                const double rng = _radarGrid.slantRange(rbin);
+                const double rng = slantRanges[rbin];
 
                 // Get current Doppler value
                 const double dopfact = (0.5 * _radarGrid.wavelength()
-                                     * (_doppler.eval(tline, rng) / satVmag)) * rng;
+                                     * (dopplers[rbin] / satVmag)) * rng;
 
                 // Store slant range bin data in Pixel
                 Pixel pixel(rng, dopfact, rbin);
@@ -253,22 +405,46 @@ topo(Raster & demRaster, TopoLayers & layers) {
                 // Save data in output arrays
                 _setOutputTopoLayers(llh, layers, blockLine, pixel, pos, vel, TCNbasis, demInterp);
 
+                // Keep target coordinates for the secondary
+                if (secondary) {
+                    for (int i = 0; i < 3; ++i) {
+                        llhLine[3*rbin + i] = llh[i];
+                    }
+                }
+
             } // end OMP for loop pixels in block
+
+            // Geo2rdr of the line targets in the secondary geometry
+            if (secondary) {
+                const size_t offset = blockLine * width;
+                offsetconv += secondary->geo2rdrLine(&llhLine[0], line, width,
+                    &rgoff[offset], &azoff[offset], azshift, rgshift);
+            }
         } // end for loop lines in block
 
         // Compute layover/shadow masks for the block
-        if (_computeMask) {
+        if (computeMask) {
             setLayoverShadow(layers, demInterp, satPosition);
         }
 
         // Write out block of data for all topo layers
         layers.writeData(0, lineStart);    
+
+        // Write out block of offsets
+        if (secondary) {
+            rgoffRaster->setBlock(rgoff, 0, lineStart, width, blockLength);
+            azoffRaster->setBlock(azoff, 0, lineStart, width, blockLength);
+        }
         
     } // end for loop blocks
 
     // Print out convergence statistics
     info << "Total convergence: " << totalconv << " out of "
          << _radarGrid.size() << pyre::journal::endl;
+    if (secondary) {
+        info << "Total offset convergence: " << offsetconv << " out of "
+             << _radarGrid.size() << pyre::journal::endl;
+    }
 
     // Print out timing information and reset
     auto timerEnd = std::chrono::steady_clock::now();
@@ -440,9 +616,20 @@ _setOutputTopoLayers(cartesian_t & targetLLH, TopoLayers & layers, size_t line,
     const double y = xyzOut[1];
 
     // Set outputs
-    layers.x(line, bin, x);
-    layers.y(line, bin, y);
-    layers.z(line, bin, targetLLH[2]);
+    if (layers.hasLayer(TOPO_X))
+        layers.x(line, bin, x);
+    if (layers.hasLayer(TOPO_Y))
+        layers.y(line, bin, y);
+    if (layers.hasLayer(TOPO_Z))
+        layers.z(line, bin, targetLLH[2]);
+
+    // Skip geometry computation if only coordinates are requested
+    const bool needLOS = layers.hasLayer(TOPO_INC) || layers.hasLayer(TOPO_HDG);
+    const bool needSlope = layers.hasLayer(TOPO_LOCALINC) || layers.hasLayer(TOPO_SIM)
+                        || layers.hasLayer(TOPO_LOCALPSI);
+    const bool needCrossTrack = layers.hasLayer(TOPO_MASK);
+    if (!(needLOS || needSlope || needCrossTrack))
+        return;
 
     // Convert llh->xyz for ground point
     const Vec3 targetXYZ = _ellipsoid.lonLatToXyz(targetLLH);
@@ -451,46 +638,57 @@ _setOutputTopoLayers(cartesian_t & targetLLH, TopoLayers & layers, size_t line,
     const Vec3 satToGround = targetXYZ - pos;
 
     // Compute cross-track range
-    layers.crossTrack(line, bin, -_lookSide * satToGround.dot(TCNbasis.x1()));
+    if (needCrossTrack)
+        layers.crossTrack(line, bin, -_lookSide * satToGround.dot(TCNbasis.x1()));
+
+    if (!(needLOS || needSlope))
+        return;
 
     // Computation in ENU coordinates around target
     const Mat3 xyz2enu = Mat3::xyzToEnu(targetLLH[1], targetLLH[0]);
     const Vec3 enu = xyz2enu.dot(satToGround);
-    const double cosalpha = std::abs(enu[2]) / enu.norm();
 
     // LOS vectors
-    layers.inc(line, bin, std::acos(cosalpha) * degrees);
-    layers.hdg(line, bin, (std::atan2(-enu[1], -enu[0]) - (0.5*M_PI)) * degrees);
+    if (layers.hasLayer(TOPO_INC)) {
+        const double cosalpha = std::abs(enu[2]) / enu.norm();
+        layers.inc(line, bin, std::acos(cosalpha) * degrees);
+    }
+    if (layers.hasLayer(TOPO_HDG))
+        layers.hdg(line, bin, (std::atan2(-enu[1], -enu[0]) - (0.5*M_PI)) * degrees);
 
-    // East-west slope using central difference
-    double aa = demInterp.interpolateXY(x - demInterp.deltaX(), y);
-    double bb = demInterp.interpolateXY(x + demInterp.deltaX(), y);
-    double gamma = targetLLH[1];
-    double alpha = ((bb - aa) * degrees) / (2.0 * _ellipsoid.rEast(gamma) * demInterp.deltaX());
+    if (!needSlope)
+        return;
 
-    // North-south slope using central difference
-    aa = demInterp.interpolateXY(x, y - demInterp.deltaY());
-    bb = demInterp.interpolateXY(x, y + demInterp.deltaY());
-    double beta = ((bb - aa) * degrees) / (2.0 * _ellipsoid.rNorth(gamma) * demInterp.deltaY());
+    // East-west and north-south slopes from DEM gradient
+    double dhdx, dhdy;
+    demInterp.interpolateXY(x, y, dhdx, dhdy);
+    double gamma = targetLLH[1];
+    double alpha = (dhdx * degrees) / _ellipsoid.rEast(gamma);
+    double beta = (dhdy * degrees) / _ellipsoid.rNorth(gamma);
 
     // Compute local incidence angle
     const Vec3 enunorm = enu.unitVec();
     const Vec3 slopevec {alpha, beta, -1.};
     const double costheta = enunorm.dot(slopevec) / slopevec.norm();
-    layers.localInc(line, bin, std::acos(costheta)*degrees);
+    if (layers.hasLayer(TOPO_LOCALINC))
+        layers.localInc(line, bin, std::acos(costheta)*degrees);
 
     // Compute amplitude simulation
-    double sintheta = std::sqrt(1.0 - (costheta * costheta));
-    bb = sintheta + 0.1 * costheta;
-    layers.sim(line, bin, std::log10(std::abs(0.01 * costheta / (bb * bb * bb))));
+    if (layers.hasLayer(TOPO_SIM)) {
+        double sintheta = std::sqrt(1.0 - (costheta * costheta));
+        const double bb = sintheta + 0.1 * costheta;
+        layers.sim(line, bin, std::log10(std::abs(0.01 * costheta / (bb * bb * bb))));
+    }
 
     // Calculate psi angle between image plane and local slope
-    const Vec3 n_imghat = -_lookSide * satToGround.cross(vel).unitVec();
-    Vec3 n_img_enu = xyz2enu.dot(n_imghat);
-    const Vec3 n_trg_enu = -slopevec;
-    const double cospsi = n_trg_enu.dot(n_img_enu)
-          / (n_trg_enu.norm() * n_img_enu.norm());
-    layers.localPsi(line, bin, std::acos(cospsi) * degrees);
+    if (layers.hasLayer(TOPO_LOCALPSI)) {
+        const Vec3 n_imghat = -_lookSide * satToGround.cross(vel).unitVec();
+        Vec3 n_img_enu = xyz2enu.dot(n_imghat);
+        const Vec3 n_trg_enu = -slopevec;
+        const double cospsi = n_trg_enu.dot(n_img_enu)
+              / (n_trg_enu.norm() * n_img_enu.norm());
+        layers.localPsi(line, bin, std::acos(cospsi) * degrees);
+    }
 }
 
 /** @param[in] layers Object containing output layers
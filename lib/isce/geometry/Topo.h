@@ -23,6 +23,7 @@
 
 // isce::geometry
 #include "geometry.h"
+#include "Geo2rdr.h"
 #include "TopoLayers.h"
 
 // Declaration
@@ -74,6 +75,15 @@ class isce::geometry::Topo {
         inline void epsgOut(int);
         /** Set mask computation flag */
         inline void computeMask(bool);
+        /** Set output layer selection (bitwise OR of topoLayer flags) */
+        inline void outputLayers(int);
+        /** Set flag for single precision x/y outputs.
+          *
+          * Float32 keeps about 7 significant digits, so x/y are rounded to
+          * roughly 1e-5 deg (~1 m) for longitude/latitude near 100 deg and to
+          * ~0.5 m for projected northings of several thousand km. Leave unset
+          * when sub-meter geolocation is needed from the x/y layers. */
+        inline void singlePrecisionXY(bool);
 
         // Get topo processing options
         /** Get lookSide used for processing */
@@ -90,6 +100,10 @@ class isce::geometry::Topo {
         inline isce::core::dataInterpMethod demMethod() const { return _demMethod; }
         /** Get mask computation flag */
         inline bool computeMask() const { return _computeMask; }
+        /** Get output layer selection */
+        inline int outputLayers() const { return _outputLayers; }
+        /** Get flag for single precision x/y outputs */
+        inline bool singlePrecisionXY() const { return _singlePrecisionXY; }
 
         /** Get read-only reference to RadarGridParameters */
         inline const isce::product::RadarGridParameters & radarGridParameters() const {
@@ -121,6 +135,17 @@ class isce::geometry::Topo {
                   isce::io::Raster & localIncRaster, isce::io::Raster & localPsiRaster,
                   isce::io::Raster & simRaster);
 
+        /** Run topo fused with geo2rdr of a secondary; internal creation of offset rasters */
+        void topo(isce::io::Raster & demRaster, const Geo2rdr & secondary,
+                  const std::string & outdir, int topoLayers = 0,
+                  double azshift = 0.0, double rgshift = 0.0);
+
+        /** Run topo fused with geo2rdr of a secondary; externally created rasters */
+        void topo(isce::io::Raster & demRaster, TopoLayers & layers,
+                  const Geo2rdr & secondary,
+                  isce::io::Raster & rgoffRaster, isce::io::Raster & azoffRaster,
+                  double azshift = 0.0, double rgshift = 0.0);
+
         /** Compute layover/shadow masks */
         void setLayoverShadow(TopoLayers &,
                               DEMInterpolator &,
@@ -136,6 +161,15 @@ class isce::geometry::Topo {
 
     private:
 
+        /** Main topo loop with optional in-memory geo2rdr of a secondary */
+        void _topo(isce::io::Raster & demRaster, TopoLayers & layers,
+                   const Geo2rdr * secondary,
+                   isce::io::Raster * rgoffRaster, isce::io::Raster * azoffRaster,
+                   double azshift, double rgshift);
+
+        /** Write multi-band VRT of selected layers in output directory */
+        void _writeTopoVRT(const std::string & outdir, int selection);
+
         /** Initialize TCN basis for given azimuth line */
         void _initAzimuthLine(size_t, double&,
                               isce::core::Vec3& pos, isce::core::Vec3& vel,
@@ -166,6 +200,8 @@ class isce::geometry::Topo {
         int _extraiter = 10;
         int _lookSide;
         size_t _linesPerBlock = 1000;
+        int _outputLayers = TOPO_ALL;
+        bool _singlePrecisionXY = false;
         bool _computeMask = true;
         isce::core::orbitInterpMethod _orbitMethod;
         isce::core::dataInterpMethod _demMethod;
@@ -15,6 +15,21 @@
 namespace isce {
     namespace geometry {
         class TopoLayers;
+
+        /** Bit flags for selecting Topo output layers */
+        enum topoLayer {
+            TOPO_X = 1 << 0,
+            TOPO_Y = 1 << 1,
+            TOPO_Z = 1 << 2,
+            TOPO_INC = 1 << 3,
+            TOPO_HDG = 1 << 4,
+            TOPO_LOCALINC = 1 << 5,
+            TOPO_LOCALPSI = 1 << 6,
+            TOPO_SIM = 1 << 7,
+            TOPO_MASK = 1 << 8,
+            TOPO_XYZ = TOPO_X | TOPO_Y | TOPO_Z,
+            TOPO_ALL = (1 << 9) - 1
+        };
     }
 }
 
@@ -24,18 +39,9 @@ class isce::geometry::TopoLayers {
         // Default constructor
         TopoLayers() : _length(0.0), _width(0.0), _haveRasters(false) {}
         // Constructors
-        TopoLayers(size_t length, size_t width) : _length(length), _width(width),
-                                                  _haveRasters(false) {
-            _x.resize(length*width);
-            _y.resize(length*width);
-            _z.resize(length*width);
-            _inc.resize(length*width);
-            _hdg.resize(length*width);
-            _localInc.resize(length*width);
-            _localPsi.resize(length*width);
-            _sim.resize(length*width);
-            _mask.resize(length*width);
-            _crossTrack.resize(length*width);
+        TopoLayers(size_t length, size_t width, int selection = TOPO_ALL) :
+            _length(length), _width(width), _haveRasters(false), _selection(selection) {
+            setBlockSize(length, width);
         }
         // Destructor
         ~TopoLayers() {
@@ -48,58 +54,71 @@ class isce::geometry::TopoLayers {
                 delete _localIncRaster;
                 delete _localPsiRaster;
                 delete _simRaster;
-                if (_maskRaster) {
-                    delete _maskRaster;
-                }
+                delete _maskRaster;
             }
         }
 
-        // Set new block sizes
+        // Set new block sizes (layers that are not selected are not allocated)
         void setBlockSize(size_t length, size_t width) {
             _length = length;
             _width = width;
-            _x.resize(length*width);
-            _y.resize(length*width);
-            _z.resize(length*width);
-            _inc.resize(length*width);
-            _hdg.resize(length*width);
-            _localInc.resize(length*width);
-            _localPsi.resize(length*width);
-            _sim.resize(length*width);
-            _mask.resize(length*width);
-            _crossTrack.resize(length*width);
+            const size_t n = length * width;
+            const bool xyDouble = !_singlePrecisionXY;
+            _x.resize(hasLayer(TOPO_X) && xyDouble ? n : 0);
+            _y.resize(hasLayer(TOPO_Y) && xyDouble ? n : 0);
+            _xSingle.resize(hasLayer(TOPO_X) && !xyDouble ? n : 0);
+            _ySingle.resize(hasLayer(TOPO_Y) && !xyDouble ? n : 0);
+            _z.resize(hasLayer(TOPO_Z) ? n : 0);
+            _inc.resize(hasLayer(TOPO_INC) ? n : 0);
+            _hdg.resize(hasLayer(TOPO_HDG) ? n : 0);
+            _localInc.resize(hasLayer(TOPO_LOCALINC) ? n : 0);
+            _localPsi.resize(hasLayer(TOPO_LOCALPSI) ? n : 0);
+            _sim.resize(hasLayer(TOPO_SIM) ? n : 0);
+            _mask.resize(hasLayer(TOPO_MASK) ? n : 0);
+            _crossTrack.resize(hasLayer(TOPO_MASK) ? n : 0);
         }
 
         // Get sizes
         inline size_t length() const { return _length; }
         inline size_t width() const { return _width; }
 
-        // Initialize rasters
+        // Get selected layers (bitwise OR of topoLayer flags)
+        inline int selection() const { return _selection; }
+        // Select layers to allocate, compute and write
+        inline void selection(int layers) { _selection = layers; }
+        // Check if a layer is selected
+        inline bool hasLayer(int layer) const { return (_selection & layer) == layer; }
+
+        // Get flag for storing x/y in single precision
+        inline bool singlePrecisionXY() const { return _singlePrecisionXY; }
+        // Set flag for storing x/y in single precision; float32 rounds x/y to
+        // ~1e-5 deg (~1 m) for geographic and up to ~0.5 m for projected outputs
+        inline void singlePrecisionXY(bool flag) { _singlePrecisionXY = flag; }
+
+        // Initialize rasters for selected layers
         void initRasters(const std::string & outdir, size_t width, size_t length,
                          bool computeMask = false) {
 
-            // Initialize the standard output rasters
-            _xRaster = new isce::io::Raster(outdir + "/x.rdr", width, length, 1,
-                GDT_Float64, "ISCE");
-            _yRaster = new isce::io::Raster(outdir + "/y.rdr", width, length, 1,
-                GDT_Float64, "ISCE");
-            _zRaster = new isce::io::Raster(outdir + "/z.rdr", width, length, 1,
-                GDT_Float64, "ISCE");
-            _incRaster = new isce::io::Raster(outdir + "/inc.rdr", width, length, 1,
-                GDT_Float32, "ISCE");
-            _hdgRaster = new isce::io::Raster(outdir + "/hdg.rdr", width, length, 1,
-                GDT_Float32, "ISCE");
-            _localIncRaster = new isce::io::Raster(outdir + "/localInc.rdr", width, length, 1,
-                GDT_Float32, "ISCE");
-            _localPsiRaster = new isce::io::Raster(outdir + "/localPsi.rdr", width, length, 1,
-                GDT_Float32, "ISCE");
-            _simRaster = new isce::io::Raster(outdir + "/simamp.rdr", width, length, 1,
-                GDT_Float32, "ISCE");
+            // Initialize the selected standard output rasters
+            const GDALDataType xyType = _singlePrecisionXY ? GDT_Float32 : GDT_Float64;
+            _xRaster = _newRaster(TOPO_X, outdir + "/x.rdr", width, length, xyType);
+            _yRaster = _newRaster(TOPO_Y, outdir + "/y.rdr", width, length, xyType);
+            _zRaster = _newRaster(TOPO_Z, outdir + "/z.rdr", width, length, GDT_Float64);
+            _incRaster = _newRaster(TOPO_INC, outdir + "/inc.rdr", width, length,
+                GDT_Float32);
+            _hdgRaster = _newRaster(TOPO_HDG, outdir + "/hdg.rdr", width, length,
+                GDT_Float32);
+            _localIncRaster = _newRaster(TOPO_LOCALINC, outdir + "/localInc.rdr", width,
+                length, GDT_Float32);
+            _localPsiRaster = _newRaster(TOPO_LOCALPSI, outdir + "/localPsi.rdr", width,
+                length, GDT_Float32);
+            _simRaster = _newRaster(TOPO_SIM, outdir + "/simamp.rdr", width, length,
+                GDT_Float32);
        
             // Optional mask raster
             if (computeMask) { 
-                _maskRaster = new isce::io::Raster(outdir + "/mask.rdr", width, length, 1,
-                    GDT_Byte, "ISCE");
+                _maskRaster = _newRaster(TOPO_MASK, outdir + "/mask.rdr", width, length,
+                    GDT_Byte);
             } else {
                 _maskRaster = nullptr;
             }
@@ -147,6 +166,8 @@ class isce::geometry::TopoLayers {
         // Get array references
         std::valarray<double> & x() { return _x; }
         std::valarray<double> & y() { return _y; }
+        std::valarray<float> & xSingle() { return _xSingle; }
+        std::valarray<float> & ySingle() { return _ySingle; }
         std::valarray<double> & z() { return _z; }
         std::valarray<float> & inc() { return _inc; }
         std::valarray<float> & hdg() { return _hdg; }
@@ -158,11 +179,19 @@ class isce::geometry::TopoLayers {
         
         // Set values for a single index
         void x(size_t row, size_t col, double value) {
-            _x[row*_width+col] = value;
+            if (_singlePrecisionXY) {
+                _xSingle[row*_width + col] = value;
+            } else {
+                _x[row*_width + col] = value;
+            }
         }
         
         void y(size_t row, size_t col, double value) {
-            _y[row*_width + col] = value;
+            if (_singlePrecisionXY) {
+                _ySingle[row*_width + col] = value;
+            } else {
+                _y[row*_width + col] = value;
+            }
         }
         
         void z(size_t row, size_t col, double value) {
@@ -199,11 +228,11 @@ class isce::geometry::TopoLayers {
 
         // Get values for a single index
         double x(size_t row, size_t col) const {
-            return _x[row*_width+col];
+            return _singlePrecisionXY ? _xSingle[row*_width + col] : _x[row*_width + col];
         }
         
         double y(size_t row, size_t col) const {
-            return _y[row*_width + col];
+            return _singlePrecisionXY ? _ySingle[row*_width + col] : _y[row*_width + col];
         }
         
         double z(size_t row, size_t col) const {
@@ -238,21 +267,43 @@ class isce::geometry::TopoLayers {
             return _crossTrack[row*_width + col];
         }
 
-        // Write data with rasters
+        // Write data of selected layers with rasters
         void writeData(size_t xidx, size_t yidx) {
-            _xRaster->setBlock(_x, xidx, yidx, _width, _length);
-            _yRaster->setBlock(_y, xidx, yidx, _width, _length);
-            _zRaster->setBlock(_z, xidx, yidx, _width, _length);
-            _incRaster->setBlock(_inc, xidx, yidx, _width, _length);
-            _hdgRaster->setBlock(_hdg, xidx, yidx, _width, _length);
-            _localIncRaster->setBlock(_localInc, xidx, yidx, _width, _length);
-            _localPsiRaster->setBlock(_localPsi, xidx, yidx, _width, _length);
-            _simRaster->setBlock(_sim, xidx, yidx, _width, _length);
-            if (_maskRaster) {
-                _maskRaster->setBlock(_mask, xidx, yidx, _width, _length);
+            if (_singlePrecisionXY) {
+                _writeLayer(TOPO_X, _xRaster, _xSingle, xidx, yidx);
+                _writeLayer(TOPO_Y, _yRaster, _ySingle, xidx, yidx);
+            } else {
+                _writeLayer(TOPO_X, _xRaster, _x, xidx, yidx);
+                _writeLayer(TOPO_Y, _yRaster, _y, xidx, yidx);
             }
+            _writeLayer(TOPO_Z, _zRaster, _z, xidx, yidx);
+            _writeLayer(TOPO_INC, _incRaster, _inc, xidx, yidx);
+            _writeLayer(TOPO_HDG, _hdgRaster, _hdg, xidx, yidx);
+            _writeLayer(TOPO_LOCALINC, _localIncRaster, _localInc, xidx, yidx);
+            _writeLayer(TOPO_LOCALPSI, _localPsiRaster, _localPsi, xidx, yidx);
+            _writeLayer(TOPO_SIM, _simRaster, _sim, xidx, yidx);
+            _writeLayer(TOPO_MASK, _maskRaster, _mask, xidx, yidx);
         }
         
+    private:
+        // Create raster for a layer if selected
+        isce::io::Raster * _newRaster(int layer, const std::string & filename,
+                                      size_t width, size_t length, GDALDataType dtype) {
+            if (!hasLayer(layer)) {
+                return nullptr;
+            }
+            return new isce::io::Raster(filename, width, length, 1, dtype, "ISCE");
+        }
+
+        // Write a block of a layer if selected and a raster is available
+        template <typename T>
+        void _writeLayer(int layer, isce::io::Raster * raster, std::valarray<T> & data,
+                         size_t xidx, size_t yidx) {
+            if (raster && hasLayer(layer)) {
+                raster->setBlock(data, xidx, yidx, _width, _length);
+            }
+        }
+
     private:
         // The valarrays for the actual data
         std::valarray<double> _x;
@@ -265,17 +316,20 @@ class isce::geometry::TopoLayers {
         std::valarray<float> _sim;
         std::valarray<short> _mask;
         std::valarray<double> _crossTrack; // internal usage only; not saved to Raster
+        // Single precision x/y
+        std::valarray<float> _xSingle;
+        std::valarray<float> _ySingle;
 
         // Raster pointers for each layer
-        isce::io::Raster * _xRaster;
-        isce::io::Raster * _yRaster;
-        isce::io::Raster * _zRaster;
-        isce::io::Raster * _incRaster;
-        isce::io::Raster * _hdgRaster;
-        isce::io::Raster * _localIncRaster;
-        isce::io::Raster * _localPsiRaster;
-        isce::io::Raster * _simRaster;
-        isce::io::Raster * _maskRaster;
+        isce::io::Raster * _xRaster = nullptr;
+        isce::io::Raster * _yRaster = nullptr;
+        isce::io::Raster * _zRaster = nullptr;
+        isce::io::Raster * _incRaster = nullptr;
+        isce::io::Raster * _hdgRaster = nullptr;
+        isce::io::Raster * _localIncRaster = nullptr;
+        isce::io::Raster * _localPsiRaster = nullptr;
+        isce::io::Raster * _simRaster = nullptr;
+        isce::io::Raster * _maskRaster = nullptr;
 
         // Dimensions
         size_t _length, _width;
@@ -283,6 +337,10 @@ class isce::geometry::TopoLayers {
         // Directory for placing rasters
         std::string _topodir;
         bool _haveRasters;
+
+        // Layer selection and storage options
+        int _selection = TOPO_ALL;
+        bool _singlePrecisionXY = false;
 };
     
 #endif
@@ -334,11 +334,33 @@ geo2rdr(const cartesian_t & inputLLH, const Ellipsoid & ellipsoid, const Orbit &
         const LUT2d<double> & doppler, double & aztime, double & slantRange,
         double wavelength, double threshold, int maxIter, double deltaRange) {
 
-    cartesian_t satpos, satvel, inputXYZ;
-
     // Convert LLH to XYZ
+    cartesian_t inputXYZ;
     ellipsoid.lonLatToXyz(inputLLH, inputXYZ);
 
+    return geo2rdrXYZ(inputXYZ, orbit, doppler, aztime, slantRange, wavelength,
+                      threshold, maxIter, deltaRange);
+}
+
+/** @param[in] inputXYZ             ECEF coordinates of target of interest
+ * @param[in] orbit                 Orbit object
+ * @param[in] doppler               LUT2d Doppler model
+ * @param[out] aztime               azimuth time of inputXYZ w.r.t reference epoch of the orbit
+ * @param[out] slantRange           slant range to inputXYZ
+ * @param[in] wavelength            Radar wavelength
+ * @param[in] threshold             azimuth time convergence threshold in seconds
+ * @param[in] maxIter               Maximum number of Newton-Raphson iterations
+ * @param[in] deltaRange            step size used for computing derivative of doppler
+ *
+ * Same as geo2rdr() for a target whose ECEF coordinates are already known, e.g. when
+ * the same target is transformed into the geometry of several acquisitions.*/
+int isce::geometry::
+geo2rdrXYZ(const cartesian_t & inputXYZ, const Orbit & orbit,
+           const LUT2d<double> & doppler, double & aztime, double & slantRange,
+           double wavelength, double threshold, int maxIter, double deltaRange) {
+
+    cartesian_t satpos, satvel;
+
     // Pre-compute scale factor for doppler
     const double dopscale = 0.5 * wavelength;
 
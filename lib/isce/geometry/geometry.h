@@ -78,6 +78,13 @@ namespace isce {
                     double &, double &,
                     double, double, int, double);
 
+        /** ECEF target coordinates to radar geometry coordinates transformer */
+        int geo2rdrXYZ(const cartesian_t &,
+                       const isce::core::Orbit &,
+                       const isce::core::LUT2d<double> &,
+                       double &, double &,
+                       double, double, int, double);
+
         /** Utility function to compute geographic bounds for a radar grid */
         void computeDEMBounds(const isce::core::Orbit & orbit,
                               const isce::core::Ellipsoid & ellipsoid,
@@ -16,6 +16,9 @@
 // isce::core
 #include "isce/core/Constants.h"
 
+// isce::except
+#include "isce/except/Error.h"
+
 // isce::image
 #include "ResampSlc.h"
 
@@ -113,6 +116,118 @@ resamp(isce::io::Raster & inputSlc, isce::io::Raster & outputSlc,
     std::cout << "Elapsed processing time: " << elapsed << " sec\n";
 }
 
+// Multi-band resamp entry point: use filenames to internally create rasters
+void isce::image::ResampSlc::
+resampBands(const std::vector<std::string> & inputFilenames,  // filenames of input SLCs
+            const std::vector<std::string> & outputFilenames, // filenames of output SLCs
+            const std::string & rgOffsetFilename,             // filename of range offsets
+            const std::string & azOffsetFilename,             // filename of azimuth offsets
+            bool flatten, int rowBuffer, int chipSize) {
+
+    // Make input rasters
+    Raster rgOffsetRaster(rgOffsetFilename, GA_ReadOnly);
+    Raster azOffsetRaster(azOffsetFilename, GA_ReadOnly);
+    std::vector<Raster> inputSlcs;
+    for (const std::string & filename : inputFilenames) {
+        inputSlcs.push_back(Raster(filename, GA_ReadOnly));
+    }
+
+    // Make output rasters; geometry defined by offset rasters
+    const int outLength = rgOffsetRaster.length();
+    const int outWidth = rgOffsetRaster.width();
+    std::vector<Raster> outputSlcs;
+    for (const std::string & filename : outputFilenames) {
+        outputSlcs.push_back(Raster(filename, outWidth, outLength, 1, GDT_CFloat32, "ISCE"));
+    }
+
+    // Call generic multi-band resamp on first band of every input
+    const std::vector<int> inputBands(inputSlcs.size(), 1);
+    resampBands(inputSlcs, outputSlcs, rgOffsetRaster, azOffsetRaster, inputBands,
+                flatten, rowBuffer, chipSize);
+}
+
+// Multi-band resamp entry point from externally created rasters. Offsets are read
+// once per tile and interpolation weights are computed once per output pixel for
+// all bands, e.g. the polarizations of a secondary acquisition.
+void isce::image::ResampSlc::
+resampBands(std::vector<Raster> & inputSlcs, std::vector<Raster> & outputSlcs,
+            Raster & rgOffsetRaster, Raster & azOffsetRaster,
+            const std::vector<int> & inputBands, bool flatten, int rowBuffer,
+            int chipSize) {
+
+    // Check consistency of inputs
+    const size_t nbands = inputSlcs.size();
+    if (nbands == 0) {
+        throw isce::except::LengthError(ISCE_SRCINFO(),
+            "ResampSlc::resampBands requires at least one input SLC");
+    }
+    if ((outputSlcs.size() != nbands) || (inputBands.size() != nbands)) {
+        throw isce::except::LengthError(ISCE_SRCINFO(),
+            "Number of input SLCs, output SLCs and input bands must match");
+    }
+    // Cache width of SLC image
+    const int inLength = inputSlcs[0].length();
+    const int inWidth = inputSlcs[0].width();
+    for (Raster & inputSlc : inputSlcs) {
+        if ((inputSlc.length() != inLength) || (inputSlc.width() != inWidth)) {
+            throw isce::except::LengthError(ISCE_SRCINFO(),
+                "Input SLCs must have the same dimensions");
+        }
+    }
+    // Cache output length and width from offset images
+    const int outLength = rgOffsetRaster.length();
+    const int outWidth = rgOffsetRaster.width();
+
+    // Initialize resampling methods
+    _prepareInterpMethods(isce::core::SINC_METHOD, chipSize-1);
+
+    // Determine number of tiles needed to process image
+    const int nTiles = _computeNumberOfTiles(outLength, _linesPerTile);
+    std::cout<<
+        "Resampling " << nbands << " bands using " << nTiles << " tiles of "
+        << _linesPerTile << " lines per tile\n";
+    // Start timer
+    auto timerStart = std::chrono::steady_clock::now();
+
+    // For each full tile of _linesPerTile lines...
+    for (int tileCount = 0; tileCount < nTiles; tileCount++) {
+
+        // Make a tile for representing input SLC data
+        Tile_t tile;
+        tile.width(inWidth);
+        // Set its line index bounds (line number in output image)
+        tile.rowStart(tileCount * _linesPerTile);
+        if (tileCount == (nTiles - 1)) {
+            tile.rowEnd(outLength);
+        } else {
+            tile.rowEnd(tile.rowStart() + _linesPerTile);
+        }
+
+        // Initialize offsets tiles once for all bands
+        isce::image::Tile<float> azOffTile, rgOffTile;
+        _initializeOffsetTiles(tile, azOffsetRaster, rgOffsetRaster,
+                               azOffTile, rgOffTile, outWidth);
+
+        // Get corresponding image indices shared by all bands
+        _computeTileRows(tile, azOffTile, inLength, outLength, rowBuffer, chipSize/2);
+
+        // Read image data of all bands
+        std::cout << "Reading in image data for tile " << tileCount << "\n";
+        std::vector<Tile_t> tiles(nbands, tile);
+        _initializeTiles(tiles, inputSlcs, inputBands);
+
+        // Perform interpolation
+        std::cout << "Interpolating tile " << tileCount << "\n";
+        _transformTiles(tiles, outputSlcs, rgOffTile, azOffTile, inLength, flatten, chipSize);
+    }
+
+    // Print out timing information and reset
+    auto timerEnd = std::chrono::steady_clock::now();
+    const double elapsed = 1.0e-3 * std::chrono::duration_cast<std::chrono::milliseconds>(
+        timerEnd - timerStart).count();
+    std::cout << "Elapsed processing time: " << elapsed << " sec\n";
+}
+
 // Initialize and read azimuth and range offsets
 void isce::image::ResampSlc::
 _initializeOffsetTiles(Tile_t & tile,
@@ -145,14 +260,12 @@ _initializeOffsetTiles(Tile_t & tile,
                             rgOffTile.width(), rgOffTile.length());
 }
 
-// Initialize tile bounds
+// Compute input image rows needed for a tile of output lines
 void isce::image::ResampSlc::
-_initializeTile(Tile_t & tile, Raster & inputSlc, const isce::image::Tile<float> & azOffTile,
-                int outLength, int rowBuffer, int chipHalf) {
+_computeTileRows(Tile_t & tile, const isce::image::Tile<float> & azOffTile,
+                 int inLength, int outLength, int rowBuffer, int chipHalf) {
 
     // Cache geometry values
-    const int inLength = inputSlc.length();
-    const int inWidth = inputSlc.width();
     const int outWidth = azOffTile.width();
 
     // Compute minimum row index needed from input image
@@ -206,7 +319,19 @@ _initializeTile(Tile_t & tile, Raster & inputSlc, const isce::image::Tile<float>
     } else {
         tile.lastImageRow(inLength);
     }
-    
+}
+
+// Initialize tile bounds
+void isce::image::ResampSlc::
+_initializeTile(Tile_t & tile, Raster & inputSlc, const isce::image::Tile<float> & azOffTile,
+                int outLength, int rowBuffer, int chipHalf) {
+
+    // Cache geometry values
+    const int inWidth = inputSlc.width();
+
+    // Compute row bounds needed from input image
+    _computeTileRows(tile, azOffTile, inputSlc.length(), outLength, rowBuffer, chipHalf);
+
     // Tile will allocate memory for itself
     tile.allocate();
 
@@ -349,4 +474,161 @@ _transformTile(Tile_t & tile,
     outputSlc.setBlock(imgOut, 0, tile.rowStart(), outWidth, outLength);
 }
 
+// Read tiles of several bands and remove the carrier evaluated once per pixel
+void isce::image::ResampSlc::
+_initializeTiles(std::vector<Tile_t> & tiles, std::vector<Raster> & inputSlcs,
+                 const std::vector<int> & inputBands) {
+
+    // All tiles share row bounds
+    const int length = tiles[0].length();
+    const int width = tiles[0].width();
+    const int firstImageRow = tiles[0].firstImageRow();
+
+    // Read in tile.length() lines of data from the input images
+    for (size_t band = 0; band < tiles.size(); ++band) {
+        tiles[band].allocate();
+        inputSlcs[band].getBlock(&tiles[band][0], 0, firstImageRow, width, length,
+                                 inputBands[band]);
+    }
+
+    // Remove carrier from input data
+    #pragma omp parallel for
+    for (int i = 0; i < length; i++) {
+        for (int j = 0; j < width; j++) {
+            // Evaluate the pixel's carrier phase
+            const double phase = modulo_f(
+                  _rgCarrier.eval(firstImageRow + i, j)
+                + _azCarrier.eval(firstImageRow + i, j), 2.0*M_PI);
+            // Remove the carrier
+            const std::complex<float> cpxPhase(std::cos(phase), -std::sin(phase));
+            for (Tile_t & tile : tiles) {
+                tile(i,j) *= cpxPhase;
+            }
+        }
+    }
+}
+
+// Interpolate tiles of several bands; offsets, Doppler, carriers and sinc weights
+// are evaluated once per output pixel
+void isce::image::ResampSlc::
+_transformTiles(std::vector<Tile_t> & tiles,
+                std::vector<Raster> & outputSlcs,
+                const isce::image::Tile<float> & rgOffTile,
+                const isce::image::Tile<float> & azOffTile,
+                int inLength, bool flatten,
+                int chipSize) {
+
+    // Cache geometry values
+    const size_t nbands = tiles.size();
+    const Tile_t & tile = tiles[0];
+    const int inWidth = tile.width();
+    const int outWidth = azOffTile.width();
+    const int outLength = azOffTile.length();
+    const int chipHalf = chipSize / 2;
+    const int taps = _interp->taps();
+    const double R0 = _startingRange;
+    const double dR = _rangePixelSpacing;
+    const double az0 = _sensingStart;
+
+    // Allocate valarrays for output image blocks initialized to zeros
+    std::vector<std::valarray<std::complex<float>>> imgOut(nbands,
+        std::valarray<std::complex<float>>(std::complex<float>(0.0, 0.0),
+                                           outLength * outWidth));
+
+    #pragma omp parallel
+    {
+
+    // Working sinc weights and azimuth deramp of a chip
+    std::vector<int> ix(taps), iy(taps);
+    std::vector<double> wx(taps), wy(taps);
+    std::vector<float> wxf(taps);
+    std::vector<std::complex<float>> rowWeight(taps);
+
+    // Loop over pixels of the tile
+    #pragma omp for
+    for (int index = 0; index < outLength * outWidth; ++index) {
+
+        const int tileLine = index / outWidth;
+        const int j = index % outWidth;
+        const int i = tile.rowStart() + tileLine;
+
+        // Unpack offsets (units of bins)
+        const float azOff = azOffTile(tileLine, j);
+        const float rgOff = rgOffTile(tileLine, j);
+
+        // Break into fractional and integer parts
+        const int intAz = static_cast<int>(i + azOff);
+        const int intRg = static_cast<int>(j + rgOff);
+        const double fracAz = i + azOff - intAz;
+        const double fracRg = j + rgOff - intRg;
+
+        // Check bounds
+        if ((intAz < chipHalf) || (intAz >= (inLength - chipHalf)))
+            continue;
+        if ((intRg < chipHalf) || (intRg >= (inWidth - chipHalf)))
+            continue;
+
+        // Evaluate Doppler polynomial
+        const double az = az0 + i / _prf;
+        const double rng = R0 + j * dR;
+        const double dop = _dopplerLUT.eval(az, rng) * 2*M_PI / _prf;
+
+        // Doppler to be added back. Simultaneously evaluate carrier that needs to
+        // be added back after interpolation
+        double phase = (dop * fracAz)
+            + _rgCarrier.eval(i + azOff, j + rgOff)
+            + _azCarrier.eval(i + azOff, j + rgOff);
+
+        // Flatten the carrier phase if requested
+        if (flatten && _haveRefData) {
+            phase += ((4. * (M_PI / _wavelength)) *
+                ((_startingRange - _refStartingRange)
+                + (j * (_rangePixelSpacing - _refRangePixelSpacing))
+                + (rgOff * _rangePixelSpacing))) + ((4.0 * M_PI
+                * (_refStartingRange + (j * _refRangePixelSpacing)))
+                * ((1.0 / _refWavelength) - (1.0 / _wavelength)));
+        }
+        // Modulate by 2*PI
+        phase = modulo_f(phase, 2.0*M_PI);
+        const std::complex<float> cphase(std::cos(phase), std::sin(phase));
+
+        // Sinc weights on the data chip
+        _interp->weights(SINC_HALF + fracRg, chipSize, &ix[0], &wx[0]);
+        _interp->weights(SINC_HALF + fracAz, chipSize, &iy[0], &wy[0]);
+        for (int jj = 0; jj < taps; ++jj) {
+            wxf[jj] = static_cast<float>(wx[jj]);
+        }
+        // Azimuth weights include removal of the Doppler of each chip row
+        for (int ii = 0; ii < taps; ++ii) {
+            const double rowPhase = dop * (iy[ii] - 4.0);
+            rowWeight[ii] = static_cast<float>(wy[ii]) *
+                std::complex<float>(std::cos(rowPhase), -std::sin(rowPhase));
+        }
+
+        // Apply the same weights to every band
+        for (size_t band = 0; band < nbands; ++band) {
+            std::complex<float> cval(0.0, 0.0);
+            for (int ii = 0; ii < taps; ++ii) {
+                const int chipRow = intAz - tile.firstImageRow() + iy[ii] - chipHalf;
+                const std::complex<float> * row = &tiles[band](chipRow, intRg - chipHalf);
+                std::complex<float> rowSum(0.0, 0.0);
+                for (int jj = 0; jj < taps; ++jj) {
+                    rowSum += wxf[jj] * row[ix[jj]];
+                }
+                cval += rowWeight[ii] * rowSum;
+            }
+            // Add doppler to interpolated value and save
+            imgOut[band][index] = cval * cphase;
+        }
+
+    } // end for over pixels
+
+    } // end multithreaded block
+
+    // Write block of data for every band
+    for (size_t band = 0; band < nbands; ++band) {
+        outputSlcs[band].setBlock(imgOut[band], 0, tile.rowStart(), outWidth, outLength);
+    }
+}
+
 // end of file
@@ -11,7 +11,9 @@
 #include <cstdint>
 #include <cstdio>
 #include <complex>
+#include <string>
 #include <valarray>
+#include <vector>
 
 // isce::core
 #include "isce/core/Interpolator.h"
@@ -128,6 +130,23 @@ class isce::image::ResampSlc {
                     const std::string & rgOffsetFilename, const std::string & azOffsetFilename,
                     int inputBand=1, bool flatten=false, bool isComplex=true, int rowBuffer=40,
                     int chipSize=isce::core::SINC_ONE);
+
+        // Multi-band resamp entry point from externally created rasters
+        void resampBands(std::vector<isce::io::Raster> & inputSlcs,
+                         std::vector<isce::io::Raster> & outputSlcs,
+                         isce::io::Raster & rgOffsetRaster,
+                         isce::io::Raster & azOffsetRaster,
+                         const std::vector<int> & inputBands,
+                         bool flatten=false, int rowBuffer=40,
+                         int chipSize=isce::core::SINC_ONE);
+
+        // Multi-band resamp entry point: use filenames to create rasters
+        void resampBands(const std::vector<std::string> & inputFilenames,
+                         const std::vector<std::string> & outputFilenames,
+                         const std::string & rgOffsetFilename,
+                         const std::string & azOffsetFilename,
+                         bool flatten=false, int rowBuffer=40,
+                         int chipSize=isce::core::SINC_ONE);
         
     // Data members
     protected:
@@ -165,11 +184,19 @@ class isce::image::ResampSlc {
                                     isce::image::Tile<float> &,
                                     isce::image::Tile<float> &, int);
 
+        // Tile row bounds from azimuth offsets
+        void _computeTileRows(Tile_t &, const isce::image::Tile<float> &,
+                              int, int, int, int);
+
         // Tile initialization for input SLC data
         void _initializeTile(Tile_t &, isce::io::Raster &,
                              const isce::image::Tile<float> &,
                              int, int, int);
 
+        // Tile initialization for several input SLC bands sharing row bounds
+        void _initializeTiles(std::vector<Tile_t> &, std::vector<isce::io::Raster> &,
+                              const std::vector<int> &);
+
         // Tile transformation
         void _transformTile(Tile_t & tile,
                             isce::io::Raster & outputSlc,
@@ -178,6 +205,14 @@ class isce::image::ResampSlc {
                             int inLength, bool flatten,
                             int chipSize);
 
+        // Tile transformation of several bands sharing offsets and weights
+        void _transformTiles(std::vector<Tile_t> & tiles,
+                             std::vector<isce::io::Raster> & outputSlcs,
+                             const isce::image::Tile<float> & rgOffTile,
+                             const isce::image::Tile<float> & azOffTile,
+                             int inLength, bool flatten,
+                             int chipSize);
+
         // Convenience functions
         inline int _computeNumberOfTiles(int, int);
 
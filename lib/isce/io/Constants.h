@@ -17,6 +17,12 @@ namespace isce {
         const std::string defaultGDALDriver = "VRT";
         /// Default GDAL data type used by Raster for creation
         const GDALDataType defaultGDALDataType = GDT_Float32;
+        /// Layout of a multi-band buffer used by Raster block I/O
+        enum bufferLayout {
+            BSQ_LAYOUT = 0,   ///< band sequential: band, line, pixel
+            BIL_LAYOUT,       ///< band interleaved by line: line, band, pixel
+            BIP_LAYOUT        ///< band interleaved by pixel: line, pixel, band
+        };
         // Unordered_map to map typeids to GDALDataTypes
         const std::unordered_map<std::type_index, GDALDataType> GDT =
           {{typeid(uint8_t),               GDT_Byte},
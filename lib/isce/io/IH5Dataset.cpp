@@ -251,6 +251,168 @@ CPLErr IH5RasterBand::IWriteBlock( int nBlockXOff,
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr IH5RasterBand::IRasterIO( GDALRWFlag eRWFlag,
+                                 int nXOff, int nYOff, int nXSize, int nYSize,
+                                 void * pData, int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType,
+                                 GSpacing nPixelSpace, GSpacing nLineSpace,
+                                 GDALRasterIOExtraArg* psExtraArg )
+{
+    IH5Dataset *poGDS = static_cast<IH5Dataset *>(poDS);
+    const int nTypeSize = GDALGetDataTypeSize(eDataType)/8;
+
+    //Requests that can be served by a single hyperslab transfer straight
+    //into the caller's buffer:
+    // - buffer type matches the native type (no conversion needed)
+    // - pixels are packed and lines are a whole number of pixels apart
+    // - window is an integer multiple of the buffer size (strided reads)
+    //   with nearest neighbor resampling
+    bool bDirect = (eBufType == eDataType) &&
+                   (poGDS->nativeType.getSize() == (size_t) nTypeSize) &&
+                   (nPixelSpace == nTypeSize) &&
+                   (nLineSpace >= nPixelSpace * nBufXSize) &&
+                   (nLineSpace % nTypeSize == 0) &&
+                   (nXSize % nBufXSize == 0) &&
+                   (nYSize % nBufYSize == 0);
+
+    if (bDirect && (psExtraArg != nullptr))
+    {
+        if (psExtraArg->bFloatingPointWindowValidity)
+            bDirect = false;
+        if ((psExtraArg->eResampleAlg != GRIORA_NearestNeighbour) &&
+            ((nXSize != nBufXSize) || (nYSize != nBufYSize)))
+            bDirect = false;
+    }
+
+    //Reads in update mode go through the block cache like before
+    if ((eRWFlag == GF_Read) && (poGDS->eAccess == GA_Update))
+        bDirect = false;
+
+    //Strided transfers are only a valid decimation for reads; writes from
+    //a smaller buffer are left to GDAL, which replicates buffer pixels
+    if ((eRWFlag == GF_Write) && ((nXSize != nBufXSize) || (nYSize != nBufYSize)))
+        bDirect = false;
+
+    if (!bDirect)
+        return GDALPamRasterBand::IRasterIO(eRWFlag, nXOff, nYOff,
+                                            nXSize, nYSize,
+                                            pData, nBufXSize, nBufYSize,
+                                            eBufType, nPixelSpace, nLineSpace,
+                                            psExtraArg);
+
+    //Any cached blocks overlapping the window would be stale after this
+    if (FlushCache() != CE_None)
+        return CE_Failure;
+
+    //Match GDAL's nearest neighbor sampling at the center of output pixels
+    const int nXStride = nXSize / nBufXSize;
+    const int nYStride = nYSize / nBufYSize;
+
+    return DirectIO(eRWFlag,
+                    nXOff + nXStride/2, nYOff + nYStride/2,
+                    nXStride, nYStride,
+                    pData, nBufXSize, nBufYSize,
+                    nLineSpace / nTypeSize);
+}
+
+/************************************************************************/
+/*                              DirectIO()                              */
+/************************************************************************/
+
+CPLErr IH5RasterBand::DirectIO( GDALRWFlag eRWFlag,
+                                int nXStart, int nYStart,
+                                int nXStride, int nYStride,
+                                void * pData, int nBufXSize, int nBufYSize,
+                                GSpacing nLineElements )
+{
+    IH5Dataset *poGDS = static_cast<IH5Dataset *>(poDS);
+    H5::DataType ioType = poGDS->nativeType;
+
+    int dims = poGDS->_dataset->getRank();
+    int starts[3];
+    int counts[3];
+    int strides[3];
+    int offset = 0;
+
+    //If 3D dataset is being used
+    if (dims == 3)
+    {
+        starts[0] = nBand-1;
+        counts[0] = 1;
+        strides[0] = 1;
+        offset = 1;
+    }
+
+    starts[offset] = nYStart;
+    starts[offset+1] = nXStart;
+    counts[offset] = nBufYSize;
+    counts[offset+1] = nBufXSize;
+    strides[offset] = nYStride;
+    strides[offset+1] = nXStride;
+
+    CPLDebug("GDAL_IH5", "%lld Direct %s, band=%d, starts=(%d,%d), "
+            "counts=(%d,%d), strides=(%d,%d)",
+            poGDS->_dataset->getId(),
+            (eRWFlag == GF_Read) ? "Read" : "Write", nBand,
+            starts[offset], starts[offset+1],
+            counts[offset], counts[offset+1],
+            strides[offset], strides[offset+1]);
+
+    H5::DataSpace dspace = poGDS->_dataset->getDataSpace(starts, counts, strides);
+    if (!H5::IdComponent::isValid(dspace.getId()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Failure to get data space in Direct IO");
+        return CE_Failure;
+    }
+
+    //Memory space spans the full line spacing of the caller's buffer
+    hsize_t bufdims[2];
+    bufdims[0] = nBufYSize;
+    bufdims[1] = nLineElements;
+
+    hsize_t bufcounts[2];
+    bufcounts[0] = nBufYSize;
+    bufcounts[1] = nBufXSize;
+
+    hsize_t bufoffsets[2];
+    bufoffsets[0] = 0;
+    bufoffsets[1] = 0;
+
+    H5::DataSpace mspace(2, bufdims);
+    mspace.selectHyperslab( H5S_SELECT_SET, bufcounts, bufoffsets);
+    if (!H5::IdComponent::isValid(mspace.getId()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Failure to get memory space in Direct IO");
+        return CE_Failure;
+    }
+
+    if (eRWFlag == GF_Read)
+        poGDS->_dataset->H5::DataSet::read(pData, ioType, mspace, dspace);
+    else
+        poGDS->_dataset->H5::DataSet::write(pData, ioType, mspace, dspace);
+
+    if (!H5::IdComponent::isValid(poGDS->_dataset->getId()))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Failure to transfer data in Direct IO");
+        return CE_Failure;
+    }
+
+    if (H5::IdComponent::isValid(dspace.getId()))
+        dspace.close();
+
+    if (H5::IdComponent::isValid(mspace.getId()))
+        mspace.close();
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                            GetNoDataValue()                          */
 /************************************************************************/
@@ -113,6 +113,10 @@ class IH5RasterBand : public GDALPamRasterBand
         bool bNoDataSet;
         double dfNoData;
 
+        /** Single hyperslab transfer between window and caller's buffer */
+        CPLErr DirectIO( GDALRWFlag, int, int, int, int,
+                         void *, int, int, GSpacing );
+
     public:
         IH5RasterBand(IH5Dataset *ds, int band, 
                       GDALDataType eTypeIn);
@@ -121,6 +125,10 @@ class IH5RasterBand : public GDALPamRasterBand
 
         virtual CPLErr IReadBlock( int, int, void * ) override;
         virtual CPLErr IWriteBlock( int, int, void * ) override;
+        virtual CPLErr IRasterIO( GDALRWFlag, int, int, int, int,
+                                  void *, int, int, GDALDataType,
+                                  GSpacing, GSpacing,
+                                  GDALRasterIOExtraArg* ) override;
         virtual double GetNoDataValue( int *pbSuccess = nullptr ) override;
         virtual CPLErr SetNoDataValue( double ) override;
 };
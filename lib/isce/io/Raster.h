@@ -157,6 +157,18 @@ class isce::io::Raster {
       template<typename T> void setBlock(std::vector<T>& vec,   size_t xidx, size_t yidx, size_t iowidth, size_t iolength, size_t band = 1);
       template<typename T> void setBlock(std::valarray<T>& arr, size_t xidx, size_t yidx, size_t iowidth, size_t iolength, size_t band = 1);
 
+      // 2D block read/write of several bands in a single RasterIO call
+      /** Get/Set block in a list of bands from raw pointer with given buffer layout */
+      template<typename T> void getSetBlock(T* buffer,          size_t xidx, size_t yidx, size_t iowidth, size_t iolength, const std::vector<int>& bands, bufferLayout layout, GDALRWFlag iodir);
+      /** Read block of data from a list of bands to buffer, vector, or valarray */
+      template<typename T> void getBlock(T* buffer,             size_t xidx, size_t yidx, size_t iowidth, size_t iolength, const std::vector<int>& bands, bufferLayout layout = BSQ_LAYOUT);
+      template<typename T> void getBlock(std::vector<T>& vec,   size_t xidx, size_t yidx, size_t iowidth, size_t iolength, const std::vector<int>& bands, bufferLayout layout = BSQ_LAYOUT);
+      template<typename T> void getBlock(std::valarray<T>& arr, size_t xidx, size_t yidx, size_t iowidth, size_t iolength, const std::vector<int>& bands, bufferLayout layout = BSQ_LAYOUT);
+      /** Write block of data to a list of bands from buffer, vector, or valarray */
+      template<typename T> void setBlock(T* buffer,             size_t xidx, size_t yidx, size_t iowidth, size_t iolength, const std::vector<int>& bands, bufferLayout layout = BSQ_LAYOUT);
+      template<typename T> void setBlock(std::vector<T>& vec,   size_t xidx, size_t yidx, size_t iowidth, size_t iolength, const std::vector<int>& bands, bufferLayout layout = BSQ_LAYOUT);
+      template<typename T> void setBlock(std::valarray<T>& arr, size_t xidx, size_t yidx, size_t iowidth, size_t iolength, const std::vector<int>& bands, bufferLayout layout = BSQ_LAYOUT);
+
       //2D block read/write for Matrix<T>, optional band index
       /** Read/write block of data from given band to/from Matrix<T> */
       template<typename T> void getBlock(isce::core::Matrix<T>& mat, size_t xidx, size_t yidx, size_t band = 1);
@@ -15,6 +15,7 @@
 #include <sstream>
 
 // isce::core
+#include <isce/core/Cube.h>
 #include <isce/core/DateTime.h>
 
 // isce::io
@@ -208,6 +209,43 @@ namespace isce {
             }
         }
 
+        /** Load Cube dataset from HDF5 file.
+          *
+          * @param[in] file          HDF5 file or group object.
+          * @param[in] datasetPath   H5 path of dataset relative to h5obj.
+          * @param[in] cube          Cube to store dataset. */
+        template <typename H5obj, typename T>
+        inline void loadFromH5(H5obj & h5obj, const std::string & datasetPath,
+                               isce::core::Cube<T> & cube) {
+            // Open dataset
+            isce::io::IDataSet dataset = h5obj.openDataSet(datasetPath);
+            // Read the Cube dataset using raw pointer interface
+            dataset.read(cube.data());
+        }
+
+        /** Write Cube dataset to HDF5 file.
+         *
+         * @param[in] file          HDF5 file or group object.
+         * @param[in] datasetPath   H5 path of dataset relative to h5obj.
+         * @param[in] cube          Cube to write.
+         * @param[in] units         Units of dataset. */
+        template <typename H5obj, typename T>
+        inline void saveToH5(H5obj & h5obj, const std::string & datasetPath,
+                             const isce::core::Cube<T> & cube,
+                             const std::string & units = "") {
+            // Check for existence of dataset
+            if (exists(h5obj, datasetPath)) {
+                return;
+            }
+            // Create dataset
+            std::array<size_t, 3> dims{cube.height(), cube.length(), cube.width()};
+            isce::io::IDataSet dset = h5obj.createDataSet(datasetPath, cube.data(), dims);
+            // Update units attribute if long enough
+            if (units.length() > 0) {
+                dset.createAttribute("units", units);
+            }
+        }
+
         /** Get dimensions of complex imagery from HDF5 file.
          *
          * @param[in] file          HDF5 file or group object.
@@ -5,8 +5,35 @@
 // Copyright 2018-
 //
 
+#include <algorithm>
+#include <numeric>
+
+// isce::except
+#include <isce/except/Error.h>
+
 #include "Covariance.h"
 
+// Remove a Faraday rotation from the scattering matrix [Shh Shv; Svh Svv]
+// given the angle delta estimated by _faradayRotationAngle:
+// S = R(delta) M R(delta) with R(x) = [cos x  sin x; -sin x  cos x]
+template<class U>
+static inline void
+removeFaradayRotation(double delta, U & Shh, U & Shv, U & Svh, U & Svv)
+{
+    const typename U::value_type a = std::cos(delta);
+    const typename U::value_type b = -std::sin(delta);
+
+    const U shh = a*a*Shh + a*b*Shv - a*b*Svh - b*b*Svv;
+    const U shv = a*a*Shv - a*b*Shh - a*b*Svv + b*b*Svh;
+    const U svh = a*b*Shh + b*b*Shv + a*a*Svh + a*b*Svv;
+    const U svv = a*b*Shv - b*b*Shh + a*a*Svv - a*b*Svh;
+
+    Shh = shh;
+    Shv = shv;
+    Svh = svh;
+    Svv = svv;
+}
+
 /**
  * @param[in] slc polarimetric channels provided as std::map of Raster object of polarimetric channels. The keys are two or four of hh, hv, vh, and vv channels.
  * @param[out] cov covariance components obtained by cross multiplication and multi-looking the polarimetric channels
@@ -90,6 +117,152 @@ covariance(std::map<std::string, isce::io::Raster> & slc,
     }
 }
 
+/**
+ * @param[in] slc quad-pol channels provided as std::map of Raster objects with keys hh, hv, vh and vv
+ * @param[out] cov the ten covariance components of the Faraday rotation corrected channels, multi-looked by the covariance looks
+ * @param[out] faradayAngleRaster raster object for Faraday rotation angle
+ * @param[in] faradayRangeLooks number of looks in range direction for Faraday rotation estimation
+ * @param[in] faradayAzimuthLooks number of looks in azimuth direction for Faraday rotation estimation
+ * @param[out] correctedSlc optional Faraday rotation corrected channels with keys hh, hv, vh and vv
+ */
+template<class T>
+void isce::signal::Covariance<T>::
+covariance(std::map<std::string, isce::io::Raster> & slc,
+            std::map<std::pair<std::string, std::string>, isce::io::Raster> & cov,
+            isce::io::Raster & faradayAngleRaster,
+            size_t faradayRangeLooks, size_t faradayAzimuthLooks,
+            std::map<std::string, isce::io::Raster> * correctedSlc)
+{
+    const std::vector<std::string> pols {"hh", "hv", "vh", "vv"};
+    const std::vector<std::pair<std::string, std::string>> terms {
+        {"hh", "hh"}, {"hh", "vh"}, {"hh", "hv"}, {"hh", "vv"},
+        {"vh", "vh"}, {"vh", "hv"}, {"vh", "vv"},
+        {"hv", "hv"}, {"hv", "vv"},
+        {"vv", "vv"}};
+
+    // Check inputs
+    for (const std::string & pol : pols) {
+        if (slc.count(pol) == 0) {
+            throw isce::except::InvalidArgument(ISCE_SRCINFO(),
+                "quad-pol data are required for Faraday rotation correction");
+        }
+        if (correctedSlc && correctedSlc->count(pol) == 0) {
+            throw isce::except::InvalidArgument(ISCE_SRCINFO(),
+                "corrected SLCs must be provided for hh, hv, vh and vv");
+        }
+    }
+    for (const auto & term : terms) {
+        if (cov.count(term) == 0) {
+            throw isce::except::InvalidArgument(ISCE_SRCINFO(),
+                "quad-pol covariance requires ten covariance components");
+        }
+    }
+    if (_rangeLooks < 1 || _azimuthLooks < 1 ||
+        faradayRangeLooks == 0 || faradayAzimuthLooks == 0) {
+        throw isce::except::InvalidArgument(ISCE_SRCINFO(),
+            "number of looks must be at least one");
+    }
+
+    const size_t nrows = slc["hh"].length();
+    const size_t ncols = slc["hh"].width();
+    const size_t rngLooks = _rangeLooks;
+    const size_t azLooks = _azimuthLooks;
+    const size_t ncolsMultiLooked = ncols/rngLooks;
+    const size_t ncolsFaraday = ncols/faradayRangeLooks;
+    if (ncolsMultiLooked == 0 || ncolsFaraday == 0) {
+        throw isce::except::LengthError(ISCE_SRCINFO(),
+            "number of range looks exceeds the width of the SLCs");
+    }
+
+    // Blocks hold a whole number of looks for both covariance and Faraday
+    // rotation estimation
+    const size_t blockAlign = std::lcm(azLooks, faradayAzimuthLooks);
+    const size_t blockRows = std::max(_linesPerBlock/blockAlign, (size_t) 1)*blockAlign;
+
+    // number of blocks to process
+    size_t nblocks = nrows / blockRows;
+    if (nblocks == 0) {
+        nblocks = 1;
+    } else if (nrows % (nblocks * blockRows) != 0) {
+        nblocks += 1;
+    }
+
+    // instantiate Looks used for multi-looking the covariance components
+    isce::signal::Looks<float> looksObj;
+    looksObj.ncols(ncols);
+    looksObj.ncolsLooked(ncolsMultiLooked);
+    looksObj.rowsLooks(azLooks);
+    looksObj.colsLooks(rngLooks);
+
+    for (size_t block = 0; block < nblocks; ++block) {
+
+        // start row and number of lines of data in this block
+        const size_t rowStart = block * blockRows;
+        const size_t blockRowsData = std::min(blockRows, nrows - rowStart);
+
+        // get blocks of quad-pol data; each channel is read once
+        std::map<std::string, std::valarray<T>> S;
+        for (const std::string & pol : pols) {
+            S[pol].resize(ncols*blockRowsData);
+            slc[pol].getBlock(S[pol], 0, rowStart, ncols, blockRowsData);
+        }
+
+        // a block shorter than the Faraday azimuth looks is estimated from all its lines
+        size_t farAzLooks = faradayAzimuthLooks;
+        if (blockRowsData < farAzLooks) {
+            farAzLooks = blockRowsData;
+        }
+        const size_t farRowsLooked = blockRowsData/farAzLooks;
+
+        // estimate and remove the Faraday rotation in memory
+        std::valarray<float> faradayAngle(ncolsFaraday*farRowsLooked);
+        _faradayRotationAngle(S["hh"], S["hv"], S["vh"], S["vv"], faradayAngle,
+                                ncols, blockRowsData,
+                                faradayRangeLooks, farAzLooks);
+
+        if (blockRowsData >= faradayAzimuthLooks) {
+            faradayAngleRaster.setBlock(faradayAngle, 0, rowStart/faradayAzimuthLooks,
+                                        ncolsFaraday, farRowsLooked);
+        }
+
+        _correctFaradayRotation(faradayAngle, S["hh"], S["hv"], S["vh"], S["vv"],
+                                ncols, blockRowsData,
+                                faradayRangeLooks, farAzLooks);
+
+        if (correctedSlc) {
+            for (const std::string & pol : pols) {
+                (*correctedSlc)[pol].setBlock(S[pol], 0, rowStart, ncols, blockRowsData);
+            }
+        }
+
+        // form and multi-look the covariance components
+        const size_t blockRowsMultiLooked = blockRowsData/azLooks;
+        if (blockRowsMultiLooked == 0) {
+            continue;
+        }
+        looksObj.nrows(blockRowsMultiLooked*azLooks);
+        looksObj.nrowsLooked(blockRowsMultiLooked);
+
+        std::valarray<std::complex<float>> product(ncols*blockRowsMultiLooked*azLooks);
+        std::valarray<std::complex<float>> productMultiLooked(
+                                ncolsMultiLooked*blockRowsMultiLooked);
+        for (const auto & term : terms) {
+
+            const std::valarray<T> & S1 = S[term.first];
+            const std::valarray<T> & S2 = S[term.second];
+
+            #pragma omp parallel for
+            for (size_t i = 0; i < product.size(); ++i) {
+                product[i] = std::complex<float>(S1[i]*std::conj(S2[i]));
+            }
+
+            looksObj.multilook(product, productMultiLooked);
+            cov[term].setBlock(productMultiLooked, 0, rowStart/azLooks,
+                                ncolsMultiLooked, blockRowsMultiLooked);
+        }
+    }
+}
+
 /**
  * @param[in] rdrCov covariance componenets in radar range-doppler coordinates
  * @param[out] geoCov geocoded covariance componenets
@@ -435,6 +608,63 @@ faradayRotation(std::map<std::string, isce::io::Raster> & slc,
 
 }
 
+/**
+ * @param[in] slc quad-pol channels provided as std::map of Raster objects with keys hh, hv, vh and vv
+ * @param[in] faradayAngle Faraday rotation angle over (line, pixel) of the SLCs, as estimated by faradayRotation
+ * @param[out] correctedSlc Faraday rotation corrected channels with keys hh, hv, vh and vv
+ */
+template<class T>
+void isce::signal::Covariance<T>::
+correctFaradayRotation(std::map<std::string, isce::io::Raster> & slc,
+                    isce::core::LUT2d<double> & faradayAngle,
+                    std::map<std::string, isce::io::Raster> & correctedSlc)
+{
+    const std::vector<std::string> pols {"hh", "hv", "vh", "vv"};
+    for (const std::string & pol : pols) {
+        if (slc.count(pol) == 0 || correctedSlc.count(pol) == 0) {
+            throw isce::except::InvalidArgument(ISCE_SRCINFO(),
+                "quad-pol data are required for Faraday rotation correction");
+        }
+    }
+
+    const size_t nrows = slc["hh"].length();
+    const size_t ncols = slc["hh"].width();
+    const size_t blockRows = std::max(_linesPerBlock, (size_t) 1);
+
+    // number of blocks to process
+    size_t nblocks = nrows / blockRows;
+    if (nblocks == 0) {
+        nblocks = 1;
+    } else if (nrows % (nblocks * blockRows) != 0) {
+        nblocks += 1;
+    }
+
+    std::valarray<T> Shh, Shv, Svh, Svv;
+    for (size_t block = 0; block < nblocks; ++block) {
+
+        // start row and number of lines of data in this block
+        const size_t rowStart = block * blockRows;
+        const size_t blockRowsData = std::min(blockRows, nrows - rowStart);
+
+        Shh.resize(ncols*blockRowsData);
+        Shv.resize(ncols*blockRowsData);
+        Svh.resize(ncols*blockRowsData);
+        Svv.resize(ncols*blockRowsData);
+        slc["hh"].getBlock(Shh, 0, rowStart, ncols, blockRowsData);
+        slc["hv"].getBlock(Shv, 0, rowStart, ncols, blockRowsData);
+        slc["vh"].getBlock(Svh, 0, rowStart, ncols, blockRowsData);
+        slc["vv"].getBlock(Svv, 0, rowStart, ncols, blockRowsData);
+
+        _correctFaradayRotation(faradayAngle, Shh, Shv, Svh, Svv,
+                                blockRowsData, ncols, rowStart);
+
+        correctedSlc["hh"].setBlock(Shh, 0, rowStart, ncols, blockRowsData);
+        correctedSlc["hv"].setBlock(Shv, 0, rowStart, ncols, blockRowsData);
+        correctedSlc["vh"].setBlock(Svh, 0, rowStart, ncols, blockRowsData);
+        correctedSlc["vv"].setBlock(Svv, 0, rowStart, ncols, blockRowsData);
+    }
+}
+
 template<class T>
 void isce::signal::Covariance<T>::
 _faradayRotationAngle(std::valarray<T>& Shh,
@@ -481,7 +711,7 @@ _faradayRotationAngle(std::valarray<T>& Shh,
 
     #pragma omp parallel for
     for (size_t i = 0; i < sizeOutput; ++i ){ 
-        faradayRotation[i] = 0.25*std::atan2(M1[i], M2[i]-M3[i]);
+        faradayRotation[i] = 0.25*std::atan2(M1avg[i], M2avg[i]-M3avg[i]);
     }
     
 }
@@ -489,10 +719,10 @@ _faradayRotationAngle(std::valarray<T>& Shh,
 template<class T>
 void isce::signal::Covariance<T>::
 _correctFaradayRotation(isce::core::LUT2d<double>& faradayAngle, 
-                        std::valarray<std::complex<float>>& Shh,
-                    std::valarray<std::complex<float>>& Shv,
-                    std::valarray<std::complex<float>>& Svh,
-                    std::valarray<std::complex<float>>& Svv,
+                        std::valarray<T>& Shh,
+                    std::valarray<T>& Shv,
+                    std::valarray<T>& Svh,
+                    std::valarray<T>& Svv,
                     size_t length,
                     size_t width,
                     size_t lineStart)
@@ -505,22 +735,33 @@ _correctFaradayRotation(isce::core::LUT2d<double>& faradayAngle,
         size_t y = line + lineStart;
     
         double delta = faradayAngle.eval(y, col);
-        float a = std::cos(delta);
-        float b = std::sin(delta);
+        removeFaradayRotation(delta, Shh[kk], Shv[kk], Svh[kk], Svv[kk]);
+    }   
+}
 
-        T shh = a*a*Shh[kk] + a*b*Shv[kk] - a*b*Svh[kk] - b*b*Svv[kk];
-        T shv = a*a*Shv[kk] + a*b*Shh[kk] - a*b*Svv[kk] + b*b*Svh[kk];
-        T svh = a*b*Shh[kk] + b*b*Shv[kk] + a*a*Svh[kk] + a*b*Svv[kk];
-        T svv = a*b*Shv[kk] - b*b*Shh[kk] + a*a*Svv[kk] - a*b*Svh[kk];
+// Remove the Faraday rotation using the angle of the multi-looked cell of each
+// pixel; trailing pixels beyond the last full cell use the last cell
+template<class T>
+void isce::signal::Covariance<T>::
+_correctFaradayRotation(std::valarray<float>& faradayAngle,
+                    std::valarray<T>& Shh,
+                    std::valarray<T>& Shv,
+                    std::valarray<T>& Svh,
+                    std::valarray<T>& Svv,
+                    size_t width, size_t length,
+                    size_t rngLooks, size_t azLooks)
+{
+    size_t widthLooked = width/rngLooks;
+    size_t lengthLooked = length/azLooks;
 
-        Shh[kk] = shh;
-        Shv[kk] = shv;
-        Svh[kk] = svh;
-        Svv[kk] = svv;
+    #pragma omp parallel for
+    for (size_t kk = 0; kk < length*width; ++kk) {
+        size_t line = std::min(kk/width/azLooks, lengthLooked - 1);
+        size_t col = std::min(kk%width/rngLooks, widthLooked - 1);
 
-        
-        
-    }   
+        double delta = faradayAngle[line*widthLooked + col];
+        removeFaradayRotation(delta, Shh[kk], Shv[kk], Svh[kk], Svv[kk]);
+    }
 }
 
 /**
@@ -70,18 +70,32 @@ class isce::signal::Covariance {
         void covariance(std::map<std::string, isce::io::Raster> & slc,
                     std::map<std::pair<std::string, std::string>, isce::io::Raster> & cov);
 
-        /** Estimate the Faraday rotation angle from quad-pol data*/
+        /** Faraday rotation corrected covariance estimation from quad-pol data.
+         * Each block of the four polarimetric channels is read once; the Faraday
+         * rotation is estimated and removed in memory before forming the covariance
+         * components. Corrected SLCs are written only if correctedSlc is given. */
+        void covariance(std::map<std::string, isce::io::Raster> & slc,
+                    std::map<std::pair<std::string, std::string>, isce::io::Raster> & cov,
+                    isce::io::Raster & faradayAngleRaster,
+                    size_t faradayRangeLooks, size_t faradayAzimuthLooks,
+                    std::map<std::string, isce::io::Raster> * correctedSlc = nullptr);
+
+        /** Estimate the Faraday rotation angle from quad-pol data.
+         *
+         * With R(x) = [cos x  sin x; -sin x  cos x], data rotated by a one-way
+         * Faraday rotation W as M = R(W) S R(W) give the angle delta = -W, i.e.
+         * the stored angle is the rotation that undoes W:
+         * S = R(delta) M R(delta). */
         void faradayRotation(std::map<std::string, isce::io::Raster> & slc,
                     isce::io::Raster & faradayAngleRaster,
                     size_t rangeLooks, size_t azimuthLooks);
 
-        
-        /** Correct Faraday rotation for quad-pol data */
-        /*
+        /** Correct Faraday rotation for quad-pol data using an angle from
+         * faradayRotation() (same sign convention), given as a LUT2d over
+         * (line, pixel) of the SLCs */
         void correctFaradayRotation(std::map<std::string, isce::io::Raster> & slc,
-                    isce::core::LUT2d & faradayAngle,
+                    isce::core::LUT2d<double> & faradayAngle,
                     std::map<std::string, isce::io::Raster> & correctedSlc);
-        */
 
         /** Estimate polarimetric orientation angle */
         void orientationAngle(isce::io::Raster& azimuthSlopeRaster,
@@ -229,14 +243,22 @@ class isce::signal::Covariance {
                     size_t rngLooks, size_t azLooks);
 
         void _correctFaradayRotation(isce::core::LUT2d<double>& faradayAngle,
-                    std::valarray<std::complex<float>>& Shh,
-                    std::valarray<std::complex<float>>& Shv,
-                    std::valarray<std::complex<float>>& Svh,
-                    std::valarray<std::complex<float>>& Svv,
+                    std::valarray<T>& Shh,
+                    std::valarray<T>& Shv,
+                    std::valarray<T>& Svh,
+                    std::valarray<T>& Svv,
                     size_t length,
                     size_t width,
                     size_t lineStart);
 
+        void _correctFaradayRotation(std::valarray<float>& faradayAngle,
+                    std::valarray<T>& Shh,
+                    std::valarray<T>& Shv,
+                    std::valarray<T>& Svh,
+                    std::valarray<T>& Svv,
+                    size_t width, size_t length,
+                    size_t rngLooks, size_t azLooks);
+
         void _orientationAngle(std::valarray<float>& azimuthSlope,
                     std::valarray<float>& rangeSlope,
                     std::valarray<float>& lookAngle,
@@ -91,7 +91,6 @@ constructRangeBandpassFilter(double rangeSamplingFrequency,
 
     int fft_size = ncols;
 
-    _filter.resize(fft_size*nrows);
     std::valarray<std::complex<T>> _filter1D(fft_size); //
     _filter1D = std::complex<T>(0.0,0.0);
 
@@ -120,13 +119,15 @@ constructRangeBandpassFilter(double rangeSamplingFrequency,
         std::cout << filterType << " filter has not been implemented" << std::endl;
     }
 
-    //construct a block of the filter with normalization
+    //store one line of the filter with normalization; it is shared by all lines
     const std::complex<T> norm(fft_size, fft_size);
-    for (size_t line = 0; line < nrows; line++ ){
-        for (size_t col = 0; col < fft_size; col++ ){
-            _filter[line*fft_size+col] = _filter1D[col] / norm;
-        }
+    _rangeFilter.resize(fft_size);
+    for (size_t col = 0; col < fft_size; col++ ){
+        _rangeFilter[col] = _filter1D[col] / norm;
     }
+    _layout = RANGE_FILTER;
+    _ncols = ncols;
+    _nrows = nrows;
 
 }
 
@@ -251,58 +252,51 @@ constructAzimuthCommonbandFilter(const isce::core::LUT1d<double> & refDoppler,
                         size_t ncols,
                         size_t nrows)
 {
-    _filter.resize(ncols*nrows);
-
-    // Pedestal-dependent frequency offset for transition region
-    const double df = 0.5 * bandwidth * beta;
-    // Compute normalization factor for preserving average power between input
-    // data and filtered data. Assumes both filter and input signal have flat
-    // spectra in the passband.
-    //const double norm = std::sqrt(input_BW / BW);
-    const double norm = 1.0;
-
     // we probably need to give next power of 2 ???
     int fft_size = nrows;
     // Construct vector of frequencies
-    std::valarray<double> frequency(fft_size);
-    fftfreq(1.0/prf, frequency);
-    
-    // Loop over range bins
-    for (int j = 0; j < ncols; ++j) {
-        // Compute center frequency of common band
-        const double fmid = 0.5 * (refDoppler.eval(j) + secDoppler.eval(j));
-
-        // Compute filter
-        for (size_t i = 0; i < frequency.size(); ++i) {
-
-            // Get the absolute value of shifted frequency
-            const double freq = std::abs(frequency[i] - fmid);
+    _azimuthFrequency.resize(fft_size);
+    fftfreq(1.0/prf, _azimuthFrequency);
 
-            // Passband
-            if (freq <= (0.5 * bandwidth - df)) {
-                _filter[i*ncols+j] = std::complex<T>(norm, 0.0);
-
-            // Transition region
-            } else if (freq > (0.5 * bandwidth - df) && freq <= (0.5 * bandwidth + df)) {
-                _filter[i*ncols+j] = std::complex<T>(norm * 0.5 * 
-                                    (1.0 + std::cos(M_PI / (bandwidth*beta) * 
-                                    (freq - 0.5 * (1.0 - beta) * bandwidth))), 0.0);
-
-            // Stop band
-            } else {
-                _filter[i*ncols+j] = std::complex<T>(0.0, 0.0);
-            }
-        }
+    // Center frequency of common band for each range bin. The filter itself
+    // is evaluated from these when applied.
+    _azimuthCenterFrequency.resize(ncols);
+    for (int j = 0; j < ncols; ++j) {
+        _azimuthCenterFrequency[j] = 0.5 * (refDoppler.eval(j) + secDoppler.eval(j));
     }
-
-    // Normalize the filter
-    const std::complex<T> filtNorm(fft_size, fft_size);
+    _azimuthBandwidth = bandwidth;
+    _azimuthBeta = beta;
+
+    // The raised cosine in the transition region is cos(a*|f - fmid| - c).
+    // Writing it as cos(a*f - (a*fmid +/- c)), with + above and - below fmid,
+    // separates it into per-line and per-column terms computed once here.
+    const double a = M_PI / (bandwidth * beta);
+    const double c = a * 0.5 * (1.0 - beta) * bandwidth;
+    _azimuthFrequencyCos.resize(fft_size);
+    _azimuthFrequencySin.resize(fft_size);
+    for (int i = 0; i < fft_size; ++i) {
+        _azimuthFrequencyCos[i] = std::cos(a * _azimuthFrequency[i]);
+        _azimuthFrequencySin[i] = std::sin(a * _azimuthFrequency[i]);
+    }
+    _upperEdgeCos.resize(ncols);
+    _upperEdgeSin.resize(ncols);
+    _lowerEdgeCos.resize(ncols);
+    _lowerEdgeSin.resize(ncols);
     for (int j = 0; j < ncols; ++j) {
-        for (size_t i = 0; i < frequency.size(); ++i) {
-            _filter[i*ncols+j] /= filtNorm;
-        }
+        const double phase = a * _azimuthCenterFrequency[j];
+        _upperEdgeCos[j] = std::cos(phase + c);
+        _upperEdgeSin[j] = std::sin(phase + c);
+        _lowerEdgeCos[j] = std::cos(phase - c);
+        _lowerEdgeSin[j] = std::sin(phase - c);
     }
 
+    // Normalization of the filter
+    _azimuthNorm = std::complex<T>(fft_size, fft_size);
+
+    _layout = AZIMUTH_FILTER;
+    _ncols = ncols;
+    _nrows = nrows;
+
     _signal.forwardAzimuthFFT(signal, spectrum, ncols, nrows);
     _signal.inverseAzimuthFFT(spectrum, signal, ncols, nrows);
 }
@@ -318,10 +312,76 @@ filter(std::valarray<std::complex<T>> &signal,
                 std::valarray<std::complex<T>> &spectrum)
 {
     _signal.forward(signal, spectrum);
-    spectrum = spectrum*_filter;
+    applyFilter(spectrum);
     _signal.inverse(spectrum, signal);   
 }
 
+/**
+* @param[in,out] spectrum block of spectrum (nrows x ncols) to be filtered
+*/
+template <class T>
+void
+isce::signal::Filter<T>::
+applyFilter(std::valarray<std::complex<T>> &spectrum) const
+{
+    if (_layout == RANGE_FILTER) {
+
+        // Broadcast the range filter over lines
+        #pragma omp parallel for
+        for (size_t line = 0; line < _nrows; ++line) {
+            std::complex<T> * data = &spectrum[line*_ncols];
+            for (size_t col = 0; col < _ncols; ++col) {
+                data[col] *= _rangeFilter[col];
+            }
+        }
+
+    } else if (_layout == AZIMUTH_FILTER) {
+
+        // Pedestal-dependent frequency offset for transition region
+        const double bandwidth = _azimuthBandwidth;
+        const double beta = _azimuthBeta;
+        const double df = 0.5 * bandwidth * beta;
+        // Compute normalization factor for preserving average power between input
+        // data and filtered data. Assumes both filter and input signal have flat
+        // spectra in the passband.
+        //const double norm = std::sqrt(input_BW / BW);
+        const double norm = 1.0;
+        const std::complex<T> passband = std::complex<T>(norm, 0.0) / _azimuthNorm;
+
+        // Each line is one frequency; each column has its own common band
+        #pragma omp parallel for
+        for (size_t line = 0; line < _nrows; ++line) {
+            const double frequency = _azimuthFrequency[line];
+            const double fcos = _azimuthFrequencyCos[line];
+            const double fsin = _azimuthFrequencySin[line];
+            std::complex<T> * data = &spectrum[line*_ncols];
+            for (size_t col = 0; col < _ncols; ++col) {
+
+                // Get the absolute value of shifted frequency
+                const double shift = frequency - _azimuthCenterFrequency[col];
+                const double freq = std::abs(shift);
+
+                // Passband
+                if (freq <= (0.5 * bandwidth - df)) {
+                    data[col] *= passband;
+
+                // Transition region, raised cosine from the precomputed terms
+                } else if (freq <= (0.5 * bandwidth + df)) {
+                    const double cosine = (shift >= 0.0) ?
+                        fcos * _upperEdgeCos[col] + fsin * _upperEdgeSin[col] :
+                        fcos * _lowerEdgeCos[col] + fsin * _lowerEdgeSin[col];
+                    const T h = norm * 0.5 * (1.0 + cosine);
+                    data[col] *= std::complex<T>(h, 0.0) / _azimuthNorm;
+
+                // Stop band
+                } else {
+                    data[col] = std::complex<T>(0.0, 0.0);
+                }
+            }
+        }
+    }
+}
+
 /**
  * @param[in] N length of the signal
  * @param[in] dt sampling interval of the signal
@@ -379,8 +439,12 @@ void
 isce::signal::Filter<T>::
 writeFilter(size_t ncols, size_t nrows)
 {
+    // Materialize the filter by applying it to a block of ones
+    std::valarray<std::complex<T>> filterBlock(std::complex<T>(1.0, 0.0), ncols*nrows);
+    applyFilter(filterBlock);
+
     isce::io::Raster filterRaster("filter.bin", ncols, nrows, 1, GDT_CFloat32, "ENVI");
-    filterRaster.setBlock(_filter, 0, 0, ncols, nrows);
+    filterRaster.setBlock(filterBlock, 0, 0, ncols, nrows);
 
 }
 
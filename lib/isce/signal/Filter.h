@@ -98,14 +98,42 @@ class isce::signal::Filter {
         void filter(std::valarray<std::complex<T>> &signal,
                 std::valarray<std::complex<T>> &spectrum);
 
+        /** Multiply a block of spectrum by the filter in place*/
+        void applyFilter(std::valarray<std::complex<T>> &spectrum) const;
+
         /** Find the index of a specific frequency for a signal with a specific sampling rate*/
         static void indexOfFrequency(double dt, int N, double f, int& n);
 
         void writeFilter(size_t ncols, size_t nrows);
 
     private:
+        /** Layout of the stored filter */
+        enum filterLayout { NO_FILTER, RANGE_FILTER, AZIMUTH_FILTER };
+
         isce::signal::Signal<T> _signal;
-        std::valarray<std::complex<T>> _filter;
+
+        // Shape of the filtered block
+        filterLayout _layout = NO_FILTER;
+        size_t _ncols = 0;
+        size_t _nrows = 0;
+
+        // Range filter: one value per frequency bin, shared by all lines
+        std::valarray<std::complex<T>> _rangeFilter;
+
+        // Azimuth filter: common band center per column, frequency per line
+        std::valarray<double> _azimuthCenterFrequency;
+        std::valarray<double> _azimuthFrequency;
+        // Raised cosine terms: cos/sin per frequency line, and per column at the
+        // upper and lower band edges
+        std::valarray<double> _azimuthFrequencyCos;
+        std::valarray<double> _azimuthFrequencySin;
+        std::valarray<double> _upperEdgeCos;
+        std::valarray<double> _upperEdgeSin;
+        std::valarray<double> _lowerEdgeCos;
+        std::valarray<double> _lowerEdgeSin;
+        double _azimuthBandwidth = 0.0;
+        double _azimuthBeta = 0.0;
+        std::complex<T> _azimuthNorm;
 
 };
 
@@ -17,7 +17,12 @@ using isce::except::LengthError;
 template<class T>
 isce::signal::NFFT<T>::
 NFFT(size_t m, size_t n, size_t fft_size)
-    : _m(m), _n(n), _fft_size(fft_size), _kernel(m,n,fft_size)
+    : _m(m), _n(n), _fft_size(fft_size),
+      // Kaiser-Bessel kernel sampled at 1024 points per unit with cubic
+      // lookup. Max lookup error relative to the kernel peak is about 1e-13
+      // for double and 1e-6, the kernel's own float round-off, for float.
+      _kernel(isce::core::NFFTKernel<T>(m,n,fft_size), 1024*(m+1),
+              /*cubic*/true)
 {
     if (n >= fft_size) {
         throw LengthError(ISCE_SRCINFO(), "Require N<NFFT for zero-padding.");
@@ -58,28 +63,37 @@ NFFT(size_t m, size_t n, size_t fft_size)
     }
 }
 
-// Digest some data.
+// Zero-pad and scale spectrum.
 template<class T>
 void
 isce::signal::NFFT<T>::
-set_spectrum(size_t size, size_t stride, const std::complex<T> *x)
+_weight_spectrum(size_t stride, const std::complex<T> *x,
+                 std::complex<T> *xf) const
 {
-    if (size != _n) {
-        throw LengthError(ISCE_SRCINFO(), "Spectrum size != NFFT size.");
-    }
     // Clear any old data.
     for (size_t i=0; i<_fft_size; ++i) {
-        _xf[i] = 0;
+        xf[i] = 0;
     }
-    // Zero-pad and scale spectrum.
-    size_t n2 = size / 2;
+    size_t n2 = _n / 2;
     for (size_t i=0; i<n2; ++i) {
-        _xf[i] = x[i*stride] * _weights[i];
+        xf[i] = x[i*stride] * _weights[i];
     }
     for (size_t i=n2; i>0; --i) {
-        _xf[_fft_size-i] = x[(size-i)*stride] * _weights[size-i];
+        xf[_fft_size-i] = x[(_n-i)*stride] * _weights[_n-i];
     }
     // NOTE For even lengths we're not splitting Nyquist bin.
+}
+
+// Digest some data.
+template<class T>
+void
+isce::signal::NFFT<T>::
+set_spectrum(size_t size, size_t stride, const std::complex<T> *x)
+{
+    if (size != _n) {
+        throw LengthError(ISCE_SRCINFO(), "Spectrum size != NFFT size.");
+    }
+    _weight_spectrum(stride, x, &_xf[0]);
     // Transform to (expanded) time-domain.
     _fft.inverse(_xf, _xt);
 }
@@ -93,18 +107,28 @@ set_spectrum(const std::valarray<std::complex<T>> &x)
     set_spectrum(x.size(), /*stride*/1, &x[0]);
 }
 
-// Emit samples.
+// Interpolate an expanded time-domain buffer.
 template<class T>
 std::complex<T>
 isce::signal::NFFT<T>::
-interp(double t) const
+_interp(const std::complex<T> *xt, double t) const
 {
     // scale time index to account for zero-padding of spectrum.
     t *= (double)_fft_size / (double)_n;
-    return isce::core::interp1d<T,std::complex<T>>(_kernel, _xt, t,
+    return isce::core::interp1d<T,std::complex<T>>(_kernel, xt, _fft_size,
+                                                   /*stride*/1, t,
                                                    /*periodic*/true);
 }
 
+// Emit samples.
+template<class T>
+std::complex<T>
+isce::signal::NFFT<T>::
+interp(double t) const
+{
+    return _interp(&_xt[0], t);
+}
+
 template<class T>
 void
 isce::signal::NFFT<T>::
@@ -138,24 +162,16 @@ execute(const std::valarray<std::complex<T>> &spectrum,
             out.size(), stride, &out[0]);
 }
 
-// Execute adjoint transform.
+// Spread time series onto expanded time-domain grid.
 template<class T>
 void
 isce::signal::NFFT<T>::
-execute_adjoint(size_t isize, size_t istride,
-                const std::complex<T> *time_series,
-                size_t tsize, size_t tstride,
-                const double *times,
-                size_t osize, size_t ostride,
-                std::complex<T> *spectrum)
+_grid(size_t nt, size_t istride, const std::complex<T> *time_series,
+      size_t tstride, const double *times, std::complex<T> *xt) const
 {
-    if (osize != _n) {
-        throw LengthError(ISCE_SRCINFO(), "Spectrum size != NFFT size.");
-    }
-    size_t nt = std::min(isize, tsize);  // TODO warn if isize!=tsize?
     // Zero-out data.
     for (size_t i=0; i<_fft_size; ++i) {
-        _xt[i] = 0.0;
+        xt[i] = 0.0;
     }
     // XXX Need signed type for loop over [-m,m].
     const long m = (long) _m;
@@ -173,19 +189,46 @@ execute_adjoint(size_t isize, size_t istride,
             long k = (ti + j) % (long)_fft_size;
             // XXX Unlike Python, C++ modulo takes sign of dividend.
             if (k < 0) k += (long)_fft_size;
-            _xt[k] += _kernel(tf + j) * time_series[i*istride];
+            xt[k] += _kernel(tf + j) * time_series[i*istride];
         }
     }
-    // FFT
-    _fft.forward(_xt, _xf);
-    // Remove filter response and copy to output.
+}
+
+// Remove filter response and copy to output.
+template<class T>
+void
+isce::signal::NFFT<T>::
+_unweight_spectrum(const std::complex<T> *xf, size_t ostride,
+                   std::complex<T> *spectrum) const
+{
     const long n2 = _n / 2;
     for (long i=0; i<n2; ++i) {
-        spectrum[i*ostride] = _n * _weights[i] * _xf[i];
+        spectrum[i*ostride] = _n * _weights[i] * xf[i];
     }
     for (long i=n2; i>0; --i) {
-        spectrum[(_n-i)*ostride] = _n * _weights[_n-i] * _xf[_fft_size-i];
+        spectrum[(_n-i)*ostride] = _n * _weights[_n-i] * xf[_fft_size-i];
+    }
+}
+
+// Execute adjoint transform.
+template<class T>
+void
+isce::signal::NFFT<T>::
+execute_adjoint(size_t isize, size_t istride,
+                const std::complex<T> *time_series,
+                size_t tsize, size_t tstride,
+                const double *times,
+                size_t osize, size_t ostride,
+                std::complex<T> *spectrum)
+{
+    if (osize != _n) {
+        throw LengthError(ISCE_SRCINFO(), "Spectrum size != NFFT size.");
     }
+    size_t nt = std::min(isize, tsize);  // TODO warn if isize!=tsize?
+    _grid(nt, istride, time_series, tstride, times, &_xt[0]);
+    // FFT
+    _fft.forward(_xt, _xf);
+    _unweight_spectrum(&_xf[0], ostride, spectrum);
 }
 
 template<class T>
@@ -200,5 +243,123 @@ execute_adjoint(const std::valarray<std::complex<T>> &time_series,
                     spectrum.size(), 1, &spectrum[0]);
 }
 
+// Set up batch buffers and plans for up to _max_batch lines.
+template<class T>
+void
+isce::signal::NFFT<T>::
+_plan_many(size_t howmany)
+{
+    const size_t batch = std::min(howmany, _max_batch);
+    if (batch <= _batch) {
+        return;
+    }
+    _batch = batch;
+    _xf_many.resize(batch * _fft_size);
+    _xt_many.resize(batch * _fft_size);
+
+    int sizes[] = {(int)_fft_size};
+    int dist = (int)_fft_size;
+    _fft_many.fftPlanBackward(_xf_many, _xt_many, /*rank*/1, &sizes[0],
+                              (int)batch,
+                              /*inembed*/NULL, /*istride*/1, dist,
+                              /*onembed*/NULL, /*ostride*/1, dist,
+                              FFTW_BACKWARD);
+    _fft_many.fftPlanForward(_xt_many, _xf_many, /*rank*/1, &sizes[0],
+                             (int)batch,
+                             /*inembed*/NULL, /*istride*/1, dist,
+                             /*onembed*/NULL, /*ostride*/1, dist,
+                             FFTW_FORWARD);
+}
+
+// Execute transforms of many lines.
+template<class T>
+void
+isce::signal::NFFT<T>::
+execute_many(size_t howmany,
+             size_t isize, size_t istride, size_t idist,
+             const std::complex<T> *spectrum,
+             size_t tsize, size_t tstride, size_t tdist,
+             const double *times,
+             size_t osize, size_t ostride, size_t odist,
+             std::complex<T> *out)
+{
+    if (isize != _n) {
+        throw LengthError(ISCE_SRCINFO(), "Spectrum size != NFFT size.");
+    }
+    if (osize < tsize) {
+        throw LengthError(ISCE_SRCINFO(), "Insufficient storage");
+    }
+    if (howmany == 0) {
+        return;
+    }
+    _plan_many(howmany);
+
+    // Lines go through the batch plan _batch at a time.  A short final chunk
+    // still runs the full plan; the unused rows are ignored.
+    for (size_t first=0; first<howmany; first+=_batch) {
+        const size_t nlines = std::min(_batch, howmany - first);
+
+        #pragma omp parallel for
+        for (size_t k=0; k<nlines; ++k) {
+            _weight_spectrum(istride, spectrum + (first+k)*idist,
+                             &_xf_many[k*_fft_size]);
+        }
+
+        // Transform chunk to (expanded) time-domain.
+        _fft_many.inverse(_xf_many, _xt_many);
+
+        #pragma omp parallel for collapse(2)
+        for (size_t k=0; k<nlines; ++k) {
+            for (size_t i=0; i<tsize; ++i) {
+                const size_t line = first + k;
+                const double t = times[line*tdist + i*tstride];
+                out[line*odist + i*ostride] = _interp(&_xt_many[k*_fft_size], t);
+            }
+        }
+    }
+}
+
+// Execute adjoint transforms of many lines.
+template<class T>
+void
+isce::signal::NFFT<T>::
+execute_adjoint_many(size_t howmany,
+                     size_t isize, size_t istride, size_t idist,
+                     const std::complex<T> *time_series,
+                     size_t tsize, size_t tstride, size_t tdist,
+                     const double *times,
+                     size_t osize, size_t ostride, size_t odist,
+                     std::complex<T> *spectrum)
+{
+    if (osize != _n) {
+        throw LengthError(ISCE_SRCINFO(), "Spectrum size != NFFT size.");
+    }
+    if (howmany == 0) {
+        return;
+    }
+    _plan_many(howmany);
+
+    // Each line is spread onto its own row, so lines are independent.
+    const size_t nt = std::min(isize, tsize);
+    for (size_t first=0; first<howmany; first+=_batch) {
+        const size_t nlines = std::min(_batch, howmany - first);
+
+        #pragma omp parallel for schedule(dynamic)
+        for (size_t k=0; k<nlines; ++k) {
+            _grid(nt, istride, time_series + (first+k)*idist, tstride,
+                  times + (first+k)*tdist, &_xt_many[k*_fft_size]);
+        }
+
+        // FFT chunk.
+        _fft_many.forward(_xt_many, _xf_many);
+
+        #pragma omp parallel for
+        for (size_t k=0; k<nlines; ++k) {
+            _unweight_spectrum(&_xf_many[k*_fft_size], ostride,
+                               spectrum + (first+k)*odist);
+        }
+    }
+}
+
 template class isce::signal::NFFT<float>;
 template class isce::signal::NFFT<double>;
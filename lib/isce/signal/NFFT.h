@@ -131,6 +131,63 @@ class isce::signal::NFFT {
                              std::complex<T> *spectrum);
 
 
+        /** Execute transforms of many lines (raw pointer interface).
+         *
+         * @param[in]  howmany  Number of lines to transform.
+         * @param[in]  isize    Length of each spectrum (should be == n)
+         * @param[in]  istride  Stride between elements of a spectrum.
+         * @param[in]  idist    Distance between first elements of spectra.
+         * @param[in]  spectrum Signals to transform, in FFTW order.
+         * @param[in]  tsize    Number of output time samples per line.
+         * @param[in]  tstride  Stride between elements of a time array.
+         * @param[in]  tdist    Distance between first elements of time
+         *                      arrays.  Use 0 to share times among lines.
+         * @param[in]  times    Desired sample locations in [0:n)
+         * @param[in]  osize    Number of output samples per line (>= tsize).
+         * @param[in]  ostride  Stride between elements of an output line.
+         * @param[in]  odist    Distance between first elements of outputs.
+         * @param[out] out      Storage for output signals.
+         *
+         * Inverse FFTs are done with a batched plan over chunks of at most
+         * 64 lines, so scratch memory does not grow with howmany.
+         * Interpolation is spread across threads.
+         * @see execute
+         */
+        void execute_many(size_t howmany,
+                          size_t isize, size_t istride, size_t idist,
+                          const std::complex<T> *spectrum,
+                          size_t tsize, size_t tstride, size_t tdist,
+                          const double *times,
+                          size_t osize, size_t ostride, size_t odist,
+                          std::complex<T> *out);
+
+        /** Execute adjoint transforms of many lines (raw pointer interface).
+         *
+         * @param[in]  howmany      Number of lines to transform.
+         * @param[in]  isize        Length of each input signal.
+         * @param[in]  istride      Stride between elements of an input signal.
+         * @param[in]  idist        Distance between first elements of inputs.
+         * @param[in]  time_series  Signals to transform.
+         * @param[in]  tsize        Length of each time vector.  Should == isize.
+         * @param[in]  tstride      Stride of a time vector.
+         * @param[in]  tdist        Distance between first elements of time
+         *                          vectors.  Use 0 to share times among lines.
+         * @param[in]  times        Sample locations in [0:n) of input signals.
+         * @param[in]  osize        Length of each output (== size_spectrum())
+         * @param[in]  ostride      Stride between elements of an output.
+         * @param[in]  odist        Distance between first elements of outputs.
+         * @param[out] spectrum     Storage for output spectra.
+         *
+         * @see execute_adjoint
+         */
+        void execute_adjoint_many(size_t howmany,
+                                  size_t isize, size_t istride, size_t idist,
+                                  const std::complex<T> *time_series,
+                                  size_t tsize, size_t tstride, size_t tdist,
+                                  const double *times,
+                                  size_t osize, size_t ostride, size_t odist,
+                                  std::complex<T> *spectrum);
+
         /** Ingest a spectrum for transform.
          *
          * @param[in] x         Spectrum to transform.  Should be in FFTW order,
@@ -171,11 +228,38 @@ class isce::signal::NFFT {
         size_t size_transform() const {return _fft_size;}
 
     private:
+        /** Zero-pad and weight one spectrum into a transform buffer. */
+        void _weight_spectrum(size_t stride, const std::complex<T> *x,
+                              std::complex<T> *xf) const;
+
+        /** Interpolate one expanded time-domain buffer at t in [0,n). */
+        std::complex<T> _interp(const std::complex<T> *xt, double t) const;
+
+        /** Spread one time series onto an expanded time-domain buffer. */
+        void _grid(size_t nt, size_t istride, const std::complex<T> *x,
+                   size_t tstride, const double *times,
+                   std::complex<T> *xt) const;
+
+        /** Remove filter response from one transformed buffer. */
+        void _unweight_spectrum(const std::complex<T> *xf, size_t stride,
+                                std::complex<T> *spectrum) const;
+
+        /** Allocate batch buffers and plans for min(howmany, _max_batch)
+         * lines, unless the current ones are already large enough. */
+        void _plan_many(size_t howmany);
+
         size_t _m, _n, _fft_size;
         std::valarray<std::complex<T>> _xf, _xt;
         std::valarray<T> _weights;
-        isce::core::NFFTKernel<T> _kernel;
+        isce::core::TabulatedKernel<T> _kernel;
         isce::signal::Signal<T> _fft;
+
+        // Batch buffers and plans for chunks of _batch lines.  They only
+        // grow, up to _max_batch lines.
+        static constexpr size_t _max_batch = 64;
+        size_t _batch = 0;
+        std::valarray<std::complex<T>> _xf_many, _xt_many;
+        isce::signal::Signal<T> _fft_many;
 };
 
 #endif
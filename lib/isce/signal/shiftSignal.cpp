@@ -25,64 +25,100 @@ shiftSignal(std::valarray<T> & data,
             const double shiftX, const double shiftY,
             isce::signal::Signal<U> & sigObj)
 {
+    const bool doShiftX = not isce::core::compareFloatingPoint(shiftX, 0.0);
+    const bool doShiftY = not isce::core::compareFloatingPoint(shiftY, 0.0);
+
+    if (not doShiftX && not doShiftY) {
+        // if no shift requested, return the original signal 
+        if (&dataShifted != &data)
+            dataShifted = data;
+        return;
+    }
 
     // variable for the total length of the signal used in FFT computation
     size_t fft_size = 1;
-    std::valarray<std::complex<U>> phaseRamp(ncols*nrows);
-    if (not isce::core::compareFloatingPoint(shiftX, 0.0)) {
-        // buffer for the frequency domain phase ramp introduced by
-        // the constant shift in time domain
-
-        // compute the frequency domain phase ramp
-        frequencyResponseRange(ncols, nrows, shiftX, phaseRamp);
 
+    // frequency domain phase ramps introduced by the constant shift in
+    // time domain. The 2D response is their outer product
+    // F(X,Y) <--> f(x,y)
+    // exp(1J(x0+y0))*F(X,Y) <--> f(x-x0,y-y0)
+    std::valarray<std::complex<U>> phaseRampX(std::complex<U>(1.0, 0.0), ncols);
+    std::valarray<std::complex<U>> phaseRampY(std::complex<U>(1.0, 0.0), nrows);
+    if (doShiftX) {
+        frequencyResponseRange(ncols, 1, shiftX, phaseRampX);
         // so far the fft length is ncols
         fft_size = ncols;
     }
-
-    if (not isce::core::compareFloatingPoint(shiftY, 0.0)) {
-
-        // buffer for the frequency domain phase ramp introduced by
-        // the constant shift in time domain
-        std::valarray<std::complex<U>> phaseRampY(ncols * nrows);
-
-        // compute the frequency domain phase ramp
-        frequencyResponseAzimuth(ncols, nrows, shiftY, phaseRampY);
-
+    if (doShiftY) {
+        frequencyResponseAzimuth(1, nrows, shiftY, phaseRampY);
         // taking into account nrows for the fft length 
-        fft_size *=nrows;
+        fft_size *= nrows;
+    }
 
-        if (not isce::core::compareFloatingPoint(shiftX, 0.0))
-            // if there was a Shift in X, the impact in frequency domain
-            // is multiplied by the impact in Y direction
-            // F(X,Y) <--> f(x,y)
-            // exp(1J(x0+y0))*F(X,Y) <--> f(x-x0,y-y0)
-            phaseRamp *= phaseRampY;
+    // since FFTW is not normalized, fold the division by the total
+    // length of fft into the range ramp
+    phaseRampX *= std::complex<U>(1.0 / fft_size, 0.0);
 
-        else
-            phaseRamp = phaseRampY;
+    shiftSignal(data, dataShifted, spectrum, phaseRampX, phaseRampY, sigObj);
+}
 
-    }
+/**
+ * @param[in,out] data data to be shifted in place
+ * @param[in] spectrum a memory block for the spectrum of the data
+ * @param[in] ncols number of columns
+ * @param[in] nrows number of rows
+ * @param[in] shiftX constant shift in X direction (columns)
+ * @param[in] shiftY constant shift in range Y direction (rows)
+ * @param[in] sigObj signal object
+ */
+template<typename T, typename U>
+void isce::signal::
+shiftSignal(std::valarray<T> & data,
+            std::valarray<std::complex<U>> & spectrum,
+            size_t ncols, size_t nrows,
+            const double shiftX, const double shiftY,
+            isce::signal::Signal<U> & sigObj)
+{
+    shiftSignal(data, data, spectrum, ncols, nrows, shiftX, shiftY, sigObj);
+}
+
+/**
+ * @param[in] data input data to be shifted
+ * @param[out] dataShifted output data after the shift (may be the same as data)
+ * @param[in] spectrum a memory block for the spectrum of the data
+ * @param[in] phaseRampX frequency domain response of the shift for each column
+ * @param[in] phaseRampY frequency domain response of the shift for each row
+ * @param[in] sigObj signal object
+ */
+template<typename T, typename U>
+void isce::signal::
+shiftSignal(std::valarray<T> & data,
+            std::valarray<T> & dataShifted,
+            std::valarray<std::complex<U>> & spectrum,
+            const std::valarray<std::complex<U>> & phaseRampX,
+            const std::valarray<std::complex<U>> & phaseRampY,
+            isce::signal::Signal<U> & sigObj) {
 
-    if (not isce::core::compareFloatingPoint(shiftX, 0.0) || 
-            not isce::core::compareFloatingPoint(shiftY, 0.0)) {
+    const size_t ncols = phaseRampX.size();
+    const size_t nrows = phaseRampY.size();
 
-        // if any shift requested at all
-        shiftSignal(data, dataShifted,
-                spectrum, phaseRamp,
-                sigObj);
-         
-        // since FFTW is not normalized, here we divide by total length of fft
-        dataShifted /= fft_size;
+    // forward FFT of the data
+    sigObj.forward(data, spectrum);
 
-    } else {
-        // if no shift requested, return the original signal 
-        dataShifted = data;
+    // mutiply the spectrum by the outer product of the ramps
+    #pragma omp parallel for
+    for (size_t row = 0; row < nrows; ++row) {
+        const std::complex<U> rampY = phaseRampY[row];
+        std::complex<U> * line = &spectrum[row*ncols];
+        for (size_t col = 0; col < ncols; ++col) {
+            line[col] *= rampY * phaseRampX[col];
+        }
     }
 
+    // inverse fft to get back the shifted signal
+    sigObj.inverse(spectrum, dataShifted);
 }
 
-
 /**
  * @param[in] data input data to be shifted
  * @param[out] dataShifted output data after the shift
@@ -238,6 +274,66 @@ shiftSignal(std::valarray<std::complex<double>> & data,
             std::valarray<std::complex<double>> & phaseRamp,
             isce::signal::Signal<double> & sigObj);
 
+template void isce::signal::
+shiftSignal(std::valarray<float> & data,
+            std::valarray<std::complex<float>> & spectrum,
+            size_t ncols, size_t nrows,
+            const double shiftX, const double shiftY,
+            isce::signal::Signal<float> & sigObj);
+
+template void isce::signal::
+shiftSignal(std::valarray<double> & data,
+            std::valarray<std::complex<double>> & spectrum,
+            size_t ncols, size_t nrows,
+            const double shiftX, const double shiftY,
+            isce::signal::Signal<double> & sigObj);
+
+template void isce::signal::
+shiftSignal(std::valarray<std::complex<float>> & data,
+            std::valarray<std::complex<float>> & spectrum,
+            size_t ncols, size_t nrows,
+            const double shiftX, const double shiftY,
+            isce::signal::Signal<float> & sigObj);
+
+template void isce::signal::
+shiftSignal(std::valarray<std::complex<double>> & data,
+            std::valarray<std::complex<double>> & spectrum,
+            size_t ncols, size_t nrows,
+            const double shiftX, const double shiftY,
+            isce::signal::Signal<double> & sigObj);
+
+template void isce::signal::
+shiftSignal(std::valarray<float> & data,
+            std::valarray<float> & dataShifted,
+            std::valarray<std::complex<float>> & spectrum,
+            const std::valarray<std::complex<float>> & phaseRampX,
+            const std::valarray<std::complex<float>> & phaseRampY,
+            isce::signal::Signal<float> & sigObj);
+
+template void isce::signal::
+shiftSignal(std::valarray<double> & data,
+            std::valarray<double> & dataShifted,
+            std::valarray<std::complex<double>> & spectrum,
+            const std::valarray<std::complex<double>> & phaseRampX,
+            const std::valarray<std::complex<double>> & phaseRampY,
+            isce::signal::Signal<double> & sigObj);
+
+template void isce::signal::
+shiftSignal(std::valarray<std::complex<float>> & data,
+            std::valarray<std::complex<float>> & dataShifted,
+            std::valarray<std::complex<float>> & spectrum,
+            const std::valarray<std::complex<float>> & phaseRampX,
+            const std::valarray<std::complex<float>> & phaseRampY,
+            isce::signal::Signal<float> & sigObj);
+
+template void isce::signal::
+shiftSignal(std::valarray<std::complex<double>> & data,
+            std::valarray<std::complex<double>> & dataShifted,
+            std::valarray<std::complex<double>> & spectrum,
+            const std::valarray<std::complex<double>> & phaseRampX,
+            const std::valarray<std::complex<double>> & phaseRampY,
+            isce::signal::Signal<double> & sigObj);
+
 template void isce::signal::
             frequencyResponseRange(size_t fft_size, size_t blockRows,
             const double shift,
@@ -37,6 +37,27 @@ namespace isce {
             std::valarray<std::complex<U>> & spectrum,
             std::valarray<std::complex<U>> & phaseRamp,
             isce::signal::Signal<U> & sigObj);
+
+        /**
+         *\brief shift a signal in place by constant offsets in x (columns) or y (rows) directions
+         */
+        template<typename T, typename U>
+        void shiftSignal(std::valarray<T> & data,
+            std::valarray<std::complex<U>> & spectrum,
+            size_t ncols, size_t nrows,
+            const double shiftX, const double shiftY,
+            isce::signal::Signal<U> & sigObj);
+
+        /**
+         *\brief shift a signal given separable frequency domain responses in x and y directions
+         */
+        template<typename T, typename U>
+        void shiftSignal(std::valarray<T> & data,
+            std::valarray<T> & dataShifted,
+            std::valarray<std::complex<U>> & spectrum,
+            const std::valarray<std::complex<U>> & phaseRampX,
+            const std::valarray<std::complex<U>> & phaseRampY,
+            isce::signal::Signal<U> & sigObj);
         
         /**
          *\brief compute the impact of a constant range pixel shift in frequency domain
@@ -1,171 +1,142 @@
+#include <algorithm> // std::max, std::min
+#include <cmath> // exp
 #include <complex> // std::complex, std::conj, std::arg
+#include <vector> // std::vector
 
 #include "PhaseGrad.h" // calcPhaseGrad
 
 namespace isce::unwrap::icu
 {
 
-template<int WINSIZE>
-void _calcPhaseGrad(
+void calcPhaseGrad(
     float * phasegradx,
     float * phasegrady,
-    const std::complex<float> * intf, 
+    const std::complex<float> * intf,
     const size_t length,
-    const size_t width)
+    const size_t width,
+    const int winsize)
 {
-    // Window weights (Gaussian kernel)
-    float weights[WINSIZE * WINSIZE];
+    const int halfwin = winsize/2;
+
+    // Window weights. The Gaussian kernel exp(-(x^2 + y^2) / (W/2)) is
+    // separable, so the 2D weighted sum is done as a row pass followed by a
+    // column pass with the same normalized 1D kernel.
+    std::vector<float> weights(winsize);
     float sum = 0.f;
-    for (int jj = 0; jj < WINSIZE; ++jj)
+    for (int ii = 0; ii < winsize; ++ii)
     {
-        for (int ii = 0; ii < WINSIZE; ++ii)
-        {
-            auto x = float(ii - WINSIZE/2);
-            auto y = float(jj - WINSIZE/2);
-            float w = exp(-(x*x + y*y) / (WINSIZE/2.f));
-            weights[jj * WINSIZE + ii] = w;
-            sum += w;
-        }
+        auto x = float(ii - halfwin);
+        float w = exp(-(x*x) / (winsize/2.f));
+        weights[ii] = w;
+        sum += w;
     }
-    for (int i = 0; i < WINSIZE * WINSIZE; ++i) { weights[i] /= sum; }
+    for (int ii = 0; ii < winsize; ++ii) { weights[ii] /= sum; }
 
     // Init phase slope.
     const size_t tilesize = length * width;
-    for (size_t i = 0; i < tilesize; ++i) 
-    { 
-        phasegradx[i] = 0.f; 
-        phasegrady[i] = 0.f; 
+    for (size_t i = 0; i < tilesize; ++i)
+    {
+        phasegradx[i] = 0.f;
+        phasegrady[i] = 0.f;
     }
 
-    // Compute smoothed phase slope using a weighted average of phase 
-    // differences.
-    #pragma omp parallel for collapse(2)
-    for (size_t j = WINSIZE/2 + 1; j < length - WINSIZE/2; ++j)
+    // Output pixels are those whose window (and first differences) lie
+    // inside the tile.
+    const size_t j0 = halfwin + 1;
+    const size_t i0 = halfwin + 1;
+    if (length < j0 + halfwin + 1 || width < i0 + halfwin + 1) { return; }
+    const size_t j1 = length - halfwin;
+    const size_t i1 = width - halfwin;
+
+    // Each thread sweeps blocks of output lines. The row-filtered lines its
+    // column pass needs are kept in a ring of winsize lines, so every row is
+    // filtered once per block and no tile-sized buffer is allocated. Blocks
+    // are long compared to the window to bound the rows filtered twice.
+    const size_t blocklines = std::max(size_t(64), size_t(4 * winsize));
+    const size_t nblocks = (j1 - j0 + blocklines - 1) / blocklines;
+
+    #pragma omp parallel
     {
-        for (size_t i = WINSIZE/2 + 1; i < width - WINSIZE/2; ++i)
+        // Per-thread line buffers of first-difference products
+        std::vector<std::complex<float>> dx(width), dy(width);
+
+        // Per-thread ring of row-filtered lines; line j lives in slot j % winsize
+        std::vector<std::complex<float>> rowx(winsize * width), rowy(winsize * width);
+
+        // Per-thread column sums
+        std::vector<std::complex<float>> sx(width), sy(width);
+
+        // Row pass: phase differences along line j, smoothed in x
+        auto filterRow = [&](size_t j)
         {
-            auto sx = std::complex<float>(0.f, 0.f);
-            auto sy = std::complex<float>(0.f, 0.f);
+            const std::complex<float> * z = &intf[j * width];
+            const std::complex<float> * zup = &intf[(j-1) * width];
+            for (size_t i = i0 - halfwin; i < i1 + halfwin; ++i)
+            {
+                dx[i] = z[i] * std::conj(z[i-1]);
+                dy[i] = z[i] * std::conj(zup[i]);
+            }
 
-            #pragma unroll
-            for (int jj = -WINSIZE/2; jj <= WINSIZE/2; ++jj)
+            std::complex<float> * rx = &rowx[(j % winsize) * width];
+            std::complex<float> * ry = &rowy[(j % winsize) * width];
+            for (size_t i = i0; i < i1; ++i)
             {
-                #pragma unroll
-                for (int ii = -WINSIZE/2; ii <= WINSIZE/2; ++ii)
+                auto tx = std::complex<float>(0.f, 0.f);
+                auto ty = std::complex<float>(0.f, 0.f);
+                for (int ii = 0; ii < winsize; ++ii)
                 {
-                    float w = weights[(jj + WINSIZE/2) * WINSIZE + (ii + WINSIZE/2)];
-
-                    std::complex<float> z_11 = intf[(j+jj) * width + (i+ii)];
-                    std::complex<float> z_10 = intf[(j+jj) * width + (i+ii-1)];
-                    std::complex<float> z_01 = intf[(j+jj-1) * width + (i+ii)];
-
-                    sx += w * z_11 * std::conj(z_10);
-                    sy += w * z_11 * std::conj(z_01);
+                    tx += weights[ii] * dx[i + ii - halfwin];
+                    ty += weights[ii] * dy[i + ii - halfwin];
                 }
+                rx[i] = tx;
+                ry[i] = ty;
             }
+        };
 
-            phasegradx[j * width + i] = std::arg(sx);
-            phasegrady[j * width + i] = std::arg(sy);
-        }
-    }
-}
-
-void _calcPhaseGrad(
-    float * phasegradx,
-    float * phasegrady,
-    const std::complex<float> * intf, 
-    const size_t length,
-    const size_t width,
-    const int winsize)
-{
-    // Window weights (Gaussian kernel)
-    auto weights = new float[winsize * winsize];
-    float sum = 0.f;
-    for (int jj = 0; jj < winsize; ++jj)
-    {
-        for (int ii = 0; ii < winsize; ++ii)
+        #pragma omp for schedule(dynamic)
+        for (size_t block = 0; block < nblocks; ++block)
         {
-            auto x = float(ii - winsize/2);
-            auto y = float(jj - winsize/2);
-            float w = exp(-(x*x + y*y) / (winsize/2.f));
-            weights[jj * winsize + ii] = w;
-            sum += w;
-        }
-    }
-    for (int i = 0; i < winsize * winsize; ++i) { weights[i] /= sum; }
+            const size_t jstart = j0 + block * blocklines;
+            const size_t jend = std::min(jstart + blocklines, j1);
 
-    // Init phase slope.
-    const size_t tilesize = length * width;
-    for (size_t i = 0; i < tilesize; ++i) 
-    { 
-        phasegradx[i] = 0.f; 
-        phasegrady[i] = 0.f; 
-    }
-
-    // Compute smoothed phase slope using a weighted average of phase 
-    // differences.
-    #pragma omp parallel for collapse(2)
-    for (size_t j = winsize/2 + 1; j < length - winsize/2; ++j)
-    {
-        for (size_t i = winsize/2 + 1; i < width - winsize/2; ++i)
-        {
-            auto sx = std::complex<float>(0.f, 0.f);
-            auto sy = std::complex<float>(0.f, 0.f);
-
-            for (int jj = -winsize/2; jj <= winsize/2; ++jj)
+            // Prime the ring with the window of the first line but its last row
+            for (size_t j = jstart - halfwin; j < jstart - halfwin + winsize - 1; ++j)
             {
-                for (int ii = -winsize/2; ii <= winsize/2; ++ii)
-                {
-                    float w = weights[(jj + winsize/2) * winsize + (ii + winsize/2)];
+                filterRow(j);
+            }
 
-                    std::complex<float> z_11 = intf[(j+jj) * width + (i+ii)];
-                    std::complex<float> z_10 = intf[(j+jj) * width + (i+ii-1)];
-                    std::complex<float> z_01 = intf[(j+jj-1) * width + (i+ii)];
+            for (size_t j = jstart; j < jend; ++j)
+            {
+                // Bring in the last row of this line's window
+                filterRow(j - halfwin + winsize - 1);
 
-                    sx += w * z_11 * std::conj(z_10);
-                    sy += w * z_11 * std::conj(z_01);
+                // Column pass: smooth in y and take the phase.
+                for (size_t i = i0; i < i1; ++i)
+                {
+                    sx[i] = std::complex<float>(0.f, 0.f);
+                    sy[i] = std::complex<float>(0.f, 0.f);
+                }
+                for (int jj = 0; jj < winsize; ++jj)
+                {
+                    const float w = weights[jj];
+                    const size_t slot = (j + jj - halfwin) % winsize;
+                    const std::complex<float> * rx = &rowx[slot * width];
+                    const std::complex<float> * ry = &rowy[slot * width];
+                    #pragma omp simd
+                    for (size_t i = i0; i < i1; ++i)
+                    {
+                        sx[i] += w * rx[i];
+                        sy[i] += w * ry[i];
+                    }
+                }
+                for (size_t i = i0; i < i1; ++i)
+                {
+                    phasegradx[j * width + i] = std::arg(sx[i]);
+                    phasegrady[j * width + i] = std::arg(sy[i]);
                 }
             }
-
-            phasegradx[j * width + i] = std::arg(sx);
-            phasegrady[j * width + i] = std::arg(sy);
         }
     }
-
-    delete[] weights;
-}
-
-void calcPhaseGrad(
-    float * phasegradx,
-    float * phasegrady,
-    const std::complex<float> * intf, 
-    const size_t length,
-    const size_t width,
-    const int winsize)
-{
-    // Let the compiler optimize for some common window sizes.
-    switch(winsize)
-    {
-        case 3: 
-            _calcPhaseGrad<3>(phasegradx, phasegrady, intf, length, width);
-            break;
-        case 5: 
-            _calcPhaseGrad<5>(phasegradx, phasegrady, intf, length, width);
-            break;
-        case 7: 
-            _calcPhaseGrad<7>(phasegradx, phasegrady, intf, length, width);
-            break;
-        case 9: 
-            _calcPhaseGrad<9>(phasegradx, phasegrady, intf, length, width);
-            break;
-        case 11: 
-            _calcPhaseGrad<11>(phasegradx, phasegrady, intf, length, width);
-            break;
-        default: 
-            _calcPhaseGrad(phasegradx, phasegrady, intf, length, width, winsize);
-            break;
-    }
 }
 
 }
-
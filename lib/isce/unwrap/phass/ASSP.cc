@@ -15,6 +15,7 @@
 #include "PhaseStatistics.h"
 #include "ASSP.h"
 #include "BMFS.h"
+#include "PixelQueue.h"
 #include "Point.h"
 #include "sort.h"
 #include <omp.h> 
@@ -1127,11 +1128,11 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
 
   double two_pi = 2.0 * 3.14159265;
   double x, seed_phase;
-  Point point, seed;
+  pixel_index_t index;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq;
+  PixelFifo workq;
   
   for(int seed_id = 0; seed_id < nr_seeds; seed_id ++) {
     //  char unwrapped = seed_id + 1;
@@ -1145,15 +1146,15 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
     visit[seed_y][seed_x] = unwrapped;
     phase_data[seed_y][seed_x] += seeds[seed_id].nr_2pi * two_pi;
 
-    workq.push(Point(seed_x, seed_y));
+    workq.clear();
+    workq.push((pixel_index_t)seed_y * nr_pixels + seed_x);
 
     // cerr << "Seed: " << Point(seed_x, seed_y) << "  nr_2pi: " << seeds[seed_id].nr_2pi << "  seed phase: " << phase_data[seed_y][seed_x] << endl;
 
     while( !workq.empty() ) {
-      point = workq.front();
-      workq.pop();
-      line  = point.get_Y();
-      pixel = point.get_X();
+      index = workq.pop();
+      line  = index / nr_pixels;
+      pixel = index % nr_pixels;
 //      visit[line][pixel] = unwrapped;
       
       seed_phase = phase_data[line][pixel];
@@ -1165,7 +1166,7 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
       
       if(line > 0) {              // facing up ......
 	if(flows[line][pixel].toRight == 0 && visit[line_minus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_minus));
+	  workq.push((pixel_index_t)line_minus * nr_pixels + pixel);
 	  x = phase_data[line_minus][pixel] - seed_phase;
 	  phase_data[line_minus][pixel] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line_minus][pixel] = unwrapped;
@@ -1173,7 +1174,7 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
       }
       if(line < nr_lines - 1) {   // facing down ......    
 	if(flows[line + 1][pixel].toRight == 0 && visit[line_plus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_plus));
+	  workq.push((pixel_index_t)line_plus * nr_pixels + pixel);
 	  x = phase_data[line_plus][pixel] - seed_phase;
 	  phase_data[line_plus][pixel] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line_plus][pixel] = unwrapped;
@@ -1181,7 +1182,7 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
       }
       if(pixel > 0) {             // facing left ......
 	if(flows[line][pixel].toDown == 0 && visit[line][pixel_minus] == not_unwrapped) {
-	  workq.push(Point(pixel_minus, line));
+	  workq.push((pixel_index_t)line * nr_pixels + pixel_minus);
 	  x = phase_data[line][pixel_minus] - seed_phase;
 	  phase_data[line][pixel_minus] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line][pixel_minus] = unwrapped;
@@ -1189,7 +1190,7 @@ DataPatch<char>* unwrap_assp(DataPatch<NodeFlow> *flows_patch, float **phase_dat
       }
       if(pixel < nr_pixels - 1) {// facing right ......
 	if(flows[line][pixel_plus].toDown == 0 && visit[line][pixel_plus] == not_unwrapped) {
-	  workq.push(Point(pixel_plus, line));
+	  workq.push((pixel_index_t)line * nr_pixels + pixel_plus);
 	  x = phase_data[line][pixel_plus] - seed_phase;
 	  phase_data[line][pixel_plus] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line][pixel_plus] = unwrapped;
@@ -1240,11 +1241,11 @@ void create_seeds(DataPatch<NodeFlow> *flows_patch, int minimum_nr_pixels, int&
     }
   }
 
-  Point point, seed;
+  pixel_index_t index;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq;
+  PixelFifo workq;
 
   int region_id = 0;
 
@@ -1264,7 +1265,8 @@ void create_seeds(DataPatch<NodeFlow> *flows_patch, int minimum_nr_pixels, int&
 
 
       int count = 0;
-      workq.push(Point(jj, ii));
+      workq.clear();
+      workq.push((pixel_index_t)ii * nr_pixels + jj);
 
       visit[ii][jj] = unwrapped;
 
@@ -1273,10 +1275,9 @@ void create_seeds(DataPatch<NodeFlow> *flows_patch, int minimum_nr_pixels, int&
       tmp_seeds[region_id].nr_2pi = 0;
       
       while( !workq.empty() ) {
-	point = workq.front();
-	workq.pop();
-	line  = point.get_Y();
-	pixel = point.get_X();
+	index = workq.pop();
+	line  = index / nr_pixels;
+	pixel = index % nr_pixels;
 
 	count ++;
 
@@ -1294,25 +1295,25 @@ void create_seeds(DataPatch<NodeFlow> *flows_patch, int minimum_nr_pixels, int&
 	
 	if(line > 0) {              // facing up ......
 	  if(flows[line][pixel].toRight == 0 && visit[line_minus][pixel] == not_unwrapped) {
-	    workq.push(Point(pixel, line_minus));
+	    workq.push((pixel_index_t)line_minus * nr_pixels + pixel);
 	    visit[line_minus][pixel] = unwrapped;
 	  }	
 	}
 	if(line < nr_lines - 1) {   // facing down ......    
 	  if(flows[line_plus][pixel].toRight == 0 && visit[line_plus][pixel] == not_unwrapped) {
-	    workq.push(Point(pixel, line_plus));
+	    workq.push((pixel_index_t)line_plus * nr_pixels + pixel);
 	    visit[line_plus][pixel] = unwrapped;
 	  }	
 	}
 	if(pixel > 0) {             // facing left ......
 	  if(flows[line][pixel].toDown == 0 && visit[line][pixel_minus] == not_unwrapped) {
-	    workq.push(Point(pixel_minus, line));
+	    workq.push((pixel_index_t)line * nr_pixels + pixel_minus);
 	    visit[line][pixel_minus] = unwrapped;
 	  }	
 	}
 	if(pixel < nr_pixels - 1) {// facing right ......
 	  if(flows[line][pixel_plus].toDown == 0 && visit[line][pixel_plus] == not_unwrapped) {
-	    workq.push(Point(pixel_plus, line));
+	    workq.push((pixel_index_t)line * nr_pixels + pixel_plus);
 	    visit[line][pixel_plus] = unwrapped;
 	  }	
 	}
@@ -1393,11 +1394,11 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
 
   double two_pi = 2.0 * 3.14159265;
   double x, seed_phase;
-  Point point, seed;
+  pixel_index_t index;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq, backupq;
+  PixelFifo workq;
   
   int nr_amb = 21;
   int *histogram = new int[nr_amb];
@@ -1417,16 +1418,15 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
 
     phase_data[seed_y][seed_x] += seeds[seed_id].nr_2pi * two_pi;
 
-    workq.push(Point(seed_x, seed_y));
-    backupq.push(Point(seed_x, seed_y));
+    workq.clear();
+    workq.push((pixel_index_t)seed_y * nr_pixels + seed_x);
 
     for(int i = 0; i < nr_amb; i++) histogram[i] = 0;
 
     while( !workq.empty() ) {
-      point = workq.front();
-      workq.pop();
-      line  = point.get_Y();
-      pixel = point.get_X();
+      index = workq.pop();
+      line  = index / nr_pixels;
+      pixel = index % nr_pixels;
       visit[line][pixel] = unwrapped;
       
       seed_phase = phase_data[line][pixel];
@@ -1444,8 +1444,7 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
       
       if(line > 0) {              // facing up ......
 	if(flows[line][pixel].toRight == 0 && visit[line_minus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_minus));
-	  backupq.push(Point(pixel, line_minus));
+	  workq.push((pixel_index_t)line_minus * nr_pixels + pixel);
 	  x = phase_data[line_minus][pixel] - seed_phase;
 	  phase_data[line_minus][pixel] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line_minus][pixel] = unwrapped;
@@ -1453,8 +1452,7 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
       }
       if(line < nr_lines - 1) {   // facing down ......    
 	if(flows[line + 1][pixel].toRight == 0 && visit[line_plus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_plus));
-	  backupq.push(Point(pixel, line_plus));
+	  workq.push((pixel_index_t)line_plus * nr_pixels + pixel);
 	  x = phase_data[line_plus][pixel] - seed_phase;
 	  phase_data[line_plus][pixel] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line_plus][pixel] = unwrapped;
@@ -1462,8 +1460,7 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
       }
       if(pixel > 0) {             // facing left ......
 	if(flows[line][pixel].toDown == 0 && visit[line][pixel_minus] == not_unwrapped) {
-	  workq.push(Point(pixel_minus, line));
-	  backupq.push(Point(pixel_minus, line));
+	  workq.push((pixel_index_t)line * nr_pixels + pixel_minus);
 	  x = phase_data[line][pixel_minus] - seed_phase;
 	  phase_data[line][pixel_minus] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line][pixel_minus] = unwrapped;
@@ -1471,8 +1468,7 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
       }
       if(pixel < nr_pixels - 1) {// facing right ......
 	if(flows[line][pixel_plus].toDown == 0 && visit[line][pixel_plus] == not_unwrapped) {
-	  workq.push(Point(pixel_plus, line));
-	  backupq.push(Point(pixel_plus, line));
+	  workq.push((pixel_index_t)line * nr_pixels + pixel_plus);
 	  x = phase_data[line][pixel_plus] - seed_phase;
 	  phase_data[line][pixel_plus] -= (int)(rint(x/two_pi)) * two_pi;
 	  visit[line][pixel_plus] = unwrapped;
@@ -1494,19 +1490,14 @@ DataPatch<char>* unwrap_adjust_seeds(DataPatch<NodeFlow> *flows_patch, float **p
     if(N != 0) {
       seeds[seed_id].nr_2pi -= N;
       double phase_adjust = two_pi * N;
-      while( !backupq.empty() ) {
-        point = backupq.front();
-        backupq.pop();
-        line  = point.get_Y();
-        pixel = point.get_X();
+      // pixels reached from this seed are the ones pushed since the seed
+      for(size_t k = 0; k < workq.pushed(); k++) {
+        index = workq[k];
+        line  = index / nr_pixels;
+        pixel = index % nr_pixels;
 	phase_data[line][pixel] -= phase_adjust;
       }
     }
-    else {
-      while( !backupq.empty() ) {
-        backupq.pop();
-      }
-    }
   }
 
   for(line = 0; line < nr_lines; line ++) {
@@ -1547,11 +1538,11 @@ DataPatch<int> * generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds
     }
   }
 
-  Point point, seed;
+  pixel_index_t index;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq;
+  PixelFifo workq;
 
   for(int seed_id = 0; seed_id < nr_seeds; seed_id ++) {
 
@@ -1561,13 +1552,13 @@ DataPatch<int> * generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds
 
     if(visit[seed_y][seed_x] != not_unwrapped) continue;
 
-    workq.push(Point(seed_x, seed_y));
+    workq.clear();
+    workq.push((pixel_index_t)seed_y * nr_pixels + seed_x);
 
     while( !workq.empty() ) {
-      point = workq.front();
-      workq.pop();
-      line  = point.get_Y();
-      pixel = point.get_X();
+      index = workq.pop();
+      line  = index / nr_pixels;
+      pixel = index % nr_pixels;
       visit[line][pixel] = seed_id;
       
       
@@ -1578,25 +1569,25 @@ DataPatch<int> * generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds
       
       if(line > 0) {              // facing up ......
 	if(flows[line][pixel].toRight == 0 && visit[line_minus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_minus));
+	  workq.push((pixel_index_t)line_minus * nr_pixels + pixel);
 	  visit[line_minus][pixel] = seed_id;
 	}	
       }
       if(line < nr_lines - 1) {   // facing down ......    
 	if(flows[line + 1][pixel].toRight == 0 && visit[line_plus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_plus));
+	  workq.push((pixel_index_t)line_plus * nr_pixels + pixel);
 	  visit[line_plus][pixel] = seed_id;
 	}	
       }
       if(pixel > 0) {             // facing left ......
 	if(flows[line][pixel].toDown == 0 && visit[line][pixel_minus] == not_unwrapped) {
-	  workq.push(Point(pixel_minus, line));
+	  workq.push((pixel_index_t)line * nr_pixels + pixel_minus);
 	  visit[line][pixel_minus] = seed_id;
 	}	
       }
       if(pixel < nr_pixels - 1) {// facing right ......
 	if(flows[line][pixel_plus].toDown == 0 && visit[line][pixel_plus] == not_unwrapped) {
-	  workq.push(Point(pixel_plus, line));
+	  workq.push((pixel_index_t)line * nr_pixels + pixel_plus);
 	  visit[line][pixel_plus] = seed_id;
 	}	
       }
@@ -1628,11 +1619,11 @@ void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seed
     }
   }
 
-  Point point, seed;
+  pixel_index_t index;
 
   NodeFlow **flows = flows_patch->get_data_lines_ptr();
 
-  queue<Point> workq;
+  PixelFifo workq;
 
   for(int seed_id = 0; seed_id < nr_seeds; seed_id ++) {
 
@@ -1642,13 +1633,13 @@ void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seed
 
     if(regions[seed_y][seed_x] != not_unwrapped) continue;
 
-    workq.push(Point(seed_x, seed_y));
+    workq.clear();
+    workq.push((pixel_index_t)seed_y * nr_pixels + seed_x);
 
     while( !workq.empty() ) {
-      point = workq.front();
-      workq.pop();
-      line  = point.get_Y();
-      pixel = point.get_X();
+      index = workq.pop();
+      line  = index / nr_pixels;
+      pixel = index % nr_pixels;
       regions[line][pixel] = seed_id;
       
       
@@ -1659,25 +1650,25 @@ void generate_regions(DataPatch<NodeFlow> *flows_patch, int nr_seeds, Seed *seed
       
       if(line > 0) {              // facing up ......
 	if(flows[line][pixel].toRight == 0 && regions[line_minus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_minus));
+	  workq.push((pixel_index_t)line_minus * nr_pixels + pixel);
 	  regions[line_minus][pixel] = seed_id;
 	}	
       }
       if(line < nr_lines - 1) {   // facing down ......    
 	if(flows[line + 1][pixel].toRight == 0 && regions[line_plus][pixel] == not_unwrapped) {
-	  workq.push(Point(pixel, line_plus));
+	  workq.push((pixel_index_t)line_plus * nr_pixels + pixel);
 	  regions[line_plus][pixel] = seed_id;
 	}	
       }
       if(pixel > 0) {             // facing left ......
 	if(flows[line][pixel].toDown == 0 && regions[line][pixel_minus] == not_unwrapped) {
-	  workq.push(Point(pixel_minus, line));
+	  workq.push((pixel_index_t)line * nr_pixels + pixel_minus);
 	  regions[line][pixel_minus] = seed_id;
 	}	
       }
       if(pixel < nr_pixels - 1) {// facing right ......
 	if(flows[line][pixel_plus].toDown == 0 && regions[line][pixel_plus] == not_unwrapped) {
-	  workq.push(Point(pixel_plus, line));
+	  workq.push((pixel_index_t)line * nr_pixels + pixel_plus);
 	  regions[line][pixel_plus] = seed_id;
 	}	
       }
@@ -1934,9 +1925,9 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 
   int nr_queues = cost_scale * min(ncols, nrows) * 2;
 
-  queue<Point> *dist_queues = new queue<Point>[nr_queues];
+  BucketQueue dist_queues(nr_queues);
   
-  Point point;
+  pixel_index_t index;
 
   uint d, curr_dist, reduced_cost;
 
@@ -1974,9 +1965,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
       if(nodes[line][pixel].supply == 0) continue;   // if Residue discharged
       dists[ line ][ pixel ] = 0;  // Otherwise set all left-over supplys to zero distance
       visit[line][pixel] = labeled;
-      point.x = pixel;
-      point.y = line;
-      dist_queues[0].push(point);
+      dist_queues.push(0, (pixel_index_t)line * ncols + pixel);
 
 //cerr << "s: " << s << "  point: " << point << "  dist: " << dists[ line ][ pixel ] << endl;
 
@@ -1990,12 +1979,12 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 //    int scanned_count = 0;
     int min_dist = 0;
     int max_dist = 0;
-    while(!dist_queues[min_dist].empty()) {  // as long as the labeled_set is not empty, do the following ......
-      point = dist_queues[min_dist].front();
-      dist_queues[min_dist].pop();
+    while(!dist_queues.empty(min_dist)) {  // as long as the labeled_set is not empty, do the following ......
+      index = dist_queues.front(min_dist);
+      dist_queues.pop(min_dist);
 
-      line = point.y;
-      pixel = point.x;
+      line = index / ncols;
+      pixel = index % ncols;
 
 //	if(pixel == 3 && line == 3) cerr << "iter: " << iter << "   min_dist: " << min_dist << "  scanned: " << point << "  dist: " << dists[line][pixel] << endl;
 
@@ -2004,7 +1993,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
       if(visit[line][pixel] == scanned) {
 	//if(nodes[line][pixel].supply == demand) scanned_count ++;
 
-	while( dist_queues[min_dist].empty()){
+	while( dist_queues.empty(min_dist)){
 	  min_dist ++;	  
 	  if(min_dist >= nr_queues) break;
 	}
@@ -2038,9 +2027,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
           visit[line][pixel - 1] = labeled;
 	  dists[line][pixel - 1] = d;
 	  branches[line][pixel - 1] = flow_right;
-	  point.x = pixel - 1;
-	  point.y = line;
-	  dist_queues[d].push(point);
+	  dist_queues.push(d, (pixel_index_t)line * ncols + pixel - 1);
 	  if(d > max_dist) max_dist = d;
 	  if(d < tmp_mind) tmp_mind = d;
 
@@ -2064,9 +2051,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 	  visit[line][pixel + 1] = labeled;
 	  dists[line][pixel + 1] = d;
 	  branches[line][pixel + 1] = flow_left;
-	  point.x = pixel + 1;
-	  point.y = line;
-	  dist_queues[d].push(point);
+	  dist_queues.push(d, (pixel_index_t)line * ncols + pixel + 1);
 	  if(d > max_dist) max_dist = d;
 	  if(d < tmp_mind) tmp_mind = d;
 	  // cerr << "Right  d : " << d << endl;
@@ -2089,9 +2074,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 	  visit[line - 1][pixel] = labeled;
 	  dists[line - 1][pixel] = d;
 	  branches[line - 1][pixel] = flow_down;
-	  point.x = pixel;
-	  point.y = line - 1;
-	  dist_queues[d].push(point);
+	  dist_queues.push(d, (pixel_index_t)(line - 1) * ncols + pixel);
 	  if(d > max_dist) max_dist = d;
 	  if(d < tmp_mind) tmp_mind = d;
 	  // cerr << "UP  d : " << d << endl;
@@ -2114,9 +2097,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 	  visit[line + 1][pixel] = labeled;
 	  dists[line + 1][pixel] = d;
 	  branches[line + 1][pixel] = flow_up;
-	  point.x = pixel;
-	  point.y = line + 1;
-	  dist_queues[d].push(point);
+	  dist_queues.push(d, (pixel_index_t)(line + 1) * ncols + pixel);
 	  if(d < tmp_mind) tmp_mind = d;
 	  if(d > max_dist) max_dist = d;
 
@@ -2129,7 +2110,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
       
       if(tmp_mind < min_dist) min_dist = tmp_mind;
       
-      while( dist_queues[min_dist].empty()){
+      while( dist_queues.empty(min_dist)){
 	min_dist ++;
 	if(min_dist > max_dist) break;
       }
@@ -2142,7 +2123,7 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
     int start_dist = 0;
     if(min_dist > 0) start_dist = min_dist;
     for(int i = start_dist; i < nr_queues; i++) {
-      dist_queues[i] = queue<Point>();
+      dist_queues.clear(i);
     }
 */
     
@@ -2375,8 +2356,6 @@ DataPatch<NodeFlow> *solve(DataPatch<Node> *node_patch)
 
   delete[] indexes;
   delete[] dd;
-
-  if(dist_queues) delete[] dist_queues;
   delete[] S;
   delete[] T;
 
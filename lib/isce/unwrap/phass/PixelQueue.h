@@ -0,0 +1,176 @@
+// Copyright (c) 2017-, California Institute of Technology ("Caltech"). U.S.
+// Government sponsorship acknowledged.
+// All rights reserved.
+//
+// Author(s):
+//
+//
+//  ======================================================================
+//
+//  FILENAME: PixelQueue.h
+//
+//  Queues of packed pixel indices (line * nr_pixels + pixel) used by the
+//  region growing loops. Indices are 64-bit so that images with more than
+//  2^32 pixels do not wrap; callers must form them in pixel_index_t, not int.
+//
+//  ======================================================================
+
+#ifndef __PIXEL_QUEUE
+#define __PIXEL_QUEUE
+
+#include <stddef.h>
+#include <vector>
+
+typedef size_t pixel_index_t;
+
+//------------------------------------------------------------------------------
+// FIFO frontier for flood fills. Storage starts small, grows on demand and
+// is reused by calling clear(); the pixels pushed since the last clear() stay
+// available through operator[] after they are popped.
+//------------------------------------------------------------------------------
+
+class PixelFifo {
+
+  private:
+
+    std::vector<pixel_index_t> data;
+    size_t head;
+    size_t tail;
+
+  public:
+
+    enum { INITIAL_CAPACITY = 4096 };
+
+    PixelFifo(size_t capacity = INITIAL_CAPACITY) : head(0), tail(0) {
+      data.reserve(capacity);
+    }
+
+    void clear() { head = 0; tail = 0; }
+    bool empty() const { return head == tail; }
+
+    void push(pixel_index_t index) {
+      if(tail < data.size()) data[tail] = index;
+      else data.push_back(index);
+      tail ++;
+    }
+    pixel_index_t pop() { return data[head ++]; }
+
+    // pixels pushed since the last clear()
+    size_t pushed() const { return tail; }
+    pixel_index_t operator[] (size_t i) const { return data[i]; }
+};
+
+//------------------------------------------------------------------------------
+// Bucket priority queue for distance ordered growing. Each bucket is a FIFO
+// made of fixed-size segments taken from a single pool; emptied segments go
+// back to a free list, so memory stays proportional to the number of queued
+// pixels rather than to the number of buckets.
+//------------------------------------------------------------------------------
+
+class BucketQueue {
+
+  private:
+
+    enum { SEGMENT_SIZE = 256 };
+
+    // segment pool
+    std::vector<pixel_index_t> pool;
+    std::vector<int> next_segment;
+    int free_segment;
+
+    // per bucket: first and last segment, read and write position
+    std::vector<int> head_segment;
+    std::vector<int> tail_segment;
+    std::vector<int> head_pos;
+    std::vector<int> tail_pos;
+
+    int new_segment() {
+      int seg = free_segment;
+      if(seg >= 0) {
+        free_segment = next_segment[seg];
+      }
+      else {
+        seg = next_segment.size();
+        next_segment.push_back(-1);
+        pool.resize(pool.size() + SEGMENT_SIZE);
+      }
+      next_segment[seg] = -1;
+      return seg;
+    }
+
+    void release_segment(int seg) {
+      next_segment[seg] = free_segment;
+      free_segment = seg;
+    }
+
+  public:
+
+    BucketQueue(int nr_buckets) :
+      free_segment(-1),
+      head_segment(nr_buckets, -1), tail_segment(nr_buckets, -1),
+      head_pos(nr_buckets, 0), tail_pos(nr_buckets, 0) {}
+
+    int nr_buckets() const { return head_segment.size(); }
+
+    bool empty(int bucket) const {
+      return bucket >= nr_buckets() || head_segment[bucket] < 0;
+    }
+
+    void push(int bucket, pixel_index_t index) {
+      if(bucket >= nr_buckets()) {
+        head_segment.resize(bucket + 1, -1);
+        tail_segment.resize(bucket + 1, -1);
+        head_pos.resize(bucket + 1, 0);
+        tail_pos.resize(bucket + 1, 0);
+      }
+      int seg = tail_segment[bucket];
+      if(seg < 0) {
+        seg = new_segment();
+        head_segment[bucket] = seg;
+        tail_segment[bucket] = seg;
+        head_pos[bucket] = 0;
+        tail_pos[bucket] = 0;
+      }
+      else if(tail_pos[bucket] == SEGMENT_SIZE) {
+        int new_seg = new_segment();
+        next_segment[seg] = new_seg;
+        tail_segment[bucket] = new_seg;
+        tail_pos[bucket] = 0;
+        seg = new_seg;
+      }
+      pool[(size_t)seg * SEGMENT_SIZE + tail_pos[bucket] ++] = index;
+    }
+
+    pixel_index_t front(int bucket) const {
+      return pool[(size_t)head_segment[bucket] * SEGMENT_SIZE + head_pos[bucket]];
+    }
+
+    void pop(int bucket) {
+      int seg = head_segment[bucket];
+      head_pos[bucket] ++;
+      if(seg == tail_segment[bucket]) {
+        if(head_pos[bucket] == tail_pos[bucket]) {   // bucket is empty
+          release_segment(seg);
+          head_segment[bucket] = -1;
+          tail_segment[bucket] = -1;
+        }
+      }
+      else if(head_pos[bucket] == SEGMENT_SIZE) {
+        head_segment[bucket] = next_segment[seg];
+        head_pos[bucket] = 0;
+        release_segment(seg);
+      }
+    }
+
+    void clear(int bucket) {
+      if(bucket >= nr_buckets()) return;
+      while(!empty(bucket)) {
+        int seg = head_segment[bucket];
+        head_segment[bucket] = (seg == tail_segment[bucket]) ? -1 : next_segment[seg];
+        release_segment(seg);
+      }
+      tail_segment[bucket] = -1;
+    }
+};
+
+#endif
@@ -41,4 +41,50 @@ def test_geo2rdr():
     np.testing.assert_almost_equal(slantrange, 830449.6727720449, decimal=6)
 
 
+def test_geo2rdr_array():
+    """
+    Test vectorized geo2rdr and rdr2geo against single calls.
+    """
+    # Open the HDF5 SLC product for the master scene
+    h5 = isceextension.pyIH5File('../../../../lib/isce/data/envisat.h5')
+
+    # Create product
+    product = isceextension.pyProduct(h5)
+
+    # Make ISCE objects
+    ellps = isceextension.pyEllipsoid()
+    orbit = product.metadata.orbit
+    doppler = product.metadata.procInfo.dopplerCentroid(freq='A')
+    wvl = product.swathA.processedWavelength
+
+    # A small set of targets around the scene center
+    lon0, lat0 = np.radians(-115.72466801139711), np.radians(34.65846532785868)
+    offsets = np.radians(np.linspace(-0.01, 0.01, 5))
+    llh = np.array([[lon0 + d, lat0 - d, 1772.0] for d in offsets])
+
+    # Vectorized geo2rdr
+    aztimes, slantranges, converged = isceextension.py_geo2rdr_array(
+        llh, ellps, orbit, doppler, wvl, threshold=1.0e-10, dR=10.0)
+    assert np.all(converged == 1)
+
+    # Compare against single calls
+    for i in range(llh.shape[0]):
+        aztime, slantrange = isceextension.py_geo2rdr(list(llh[i]), ellps, orbit,
+                                                      doppler, wvl, threshold=1.0e-10,
+                                                      dR=10.0)
+        np.testing.assert_almost_equal(aztimes[i], aztime, decimal=9)
+        np.testing.assert_almost_equal(slantranges[i], slantrange, decimal=6)
+
+    # Vectorized rdr2geo at zero doppler and constant height
+    zero_doppler = isceextension.pyLUT2d()
+    aztimes, slantranges, converged = isceextension.py_geo2rdr_array(
+        llh, ellps, orbit, zero_doppler, wvl, threshold=1.0e-10, dR=10.0)
+    llh_out, converged = isceextension.py_rdr2geo_array(
+        orbit, ellps, aztimes, slantranges, -1, wvl=wvl, threshold=1.0e-8,
+        demInterpolatorHeight=1772.0)
+    assert np.all(converged == 1)
+    np.testing.assert_allclose(llh_out[:, :2], llh[:, :2], atol=1.0e-8)
+    np.testing.assert_allclose(llh_out[:, 2], llh[:, 2], atol=1.0e-2)
+
+
 # end of file
@@ -144,9 +144,57 @@ def test_createNumpyDataset():
     dset = None
     del raster
 
+def test_getSetBlock():
+    import numpy as np
+    import numpy.testing as npt
+    from isce3.extensions.isceextension import pyRaster
+    import os
+
+    cmn = commonClass()
+    if os.path.exists(cmn.mskFilename):
+        os.remove(cmn.mskFilename)
+
+    raster = pyRaster(cmn.mskFilename, width=cmn.nc, length=cmn.nl,
+                        numBands=1, dtype=gdal.GDT_Float32,
+                        driver='ENVI', access=gdal.GA_Update)
+
+    # Write full raster then a sub-block
+    data = np.arange(cmn.nl * cmn.nc, dtype=np.float32).reshape(cmn.nl, cmn.nc)
+    raster.setBlock(data)
+    block = -np.ones((cmn.nby, cmn.nbx), dtype=np.float32)
+    raster.setBlock(block, xoff=3, yoff=4)
+    data[4:4+cmn.nby, 3:3+cmn.nbx] = block
+
+    # Read back into caller-provided arrays
+    out = np.zeros((cmn.nl, cmn.nc), dtype=np.float32)
+    raster.getBlock(out)
+    npt.assert_array_equal(out, data)
+
+    sub = np.zeros((cmn.nby, cmn.nbx), dtype=np.float32)
+    raster.getBlock(sub, xoff=10, yoff=20)
+    npt.assert_array_equal(sub, data[20:20+cmn.nby, 10:10+cmn.nbx])
+
+    # Out of bounds requests are rejected
+    try:
+        raster.getBlock(out, xoff=1)
+        assert False, 'Out of bounds block request was accepted'
+    except ValueError:
+        pass
+
+    # Memory-mapped view of the raw file, when available
+    try:
+        view = np.asarray(raster.memoryview())
+    except NotImplementedError:
+        view = None
+    if view is not None:
+        npt.assert_array_equal(view, data)
+
+    del raster
+
 if __name__ == '__main__':
     test_createGeoTiffFloat()
     test_createVRTDouble_setGetValue()
     test_createTwoBandEnvi()
     test_createMultiBandVRT()
     test_createNumpyDataset()
+    test_getSetBlock()
@@ -10,6 +10,7 @@ include isce.def
 # the pile of tests
 TESTS = \
     euler \
+    evaluator \
 
 all: test clean
 
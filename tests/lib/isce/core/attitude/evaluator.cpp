@@ -0,0 +1,149 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+// Copyright 2019
+//
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "isce/core/Utilities.h"
+#include "isce/core/EulerAngles.h"
+#include "isce/core/AttitudeEvaluator.h"
+
+
+struct AttitudeEvaluatorTest : public ::testing::Test {
+
+    typedef isce::core::EulerAngles EulerAngles;
+    typedef isce::core::AttitudeEvaluator AttitudeEvaluator;
+    typedef isce::core::cartmat_t cartmat_t;
+
+    double tol;
+    cartmat_t R_ypr_ref;
+    std::vector<double> time;
+
+    protected:
+
+        AttitudeEvaluatorTest() {
+
+            // Make an array of epoch times
+            time = isce::core::linspace(0.0, 10.0, 20);
+
+            // Define the reference rotation matrix (YPR) for constant angles
+            R_ypr_ref = {{
+                {0.993760669166, -0.104299329454, 0.039514330251},
+                {0.099708650872, 0.989535160981, 0.104299329454},
+                {-0.049979169271, -0.099708650872, 0.993760669166}
+            }};
+
+            // Set tolerance
+            tol = 1.0e-10;
+        }
+
+        ~AttitudeEvaluatorTest() {}
+};
+
+TEST_F(AttitudeEvaluatorTest, ConstantEulerAngles) {
+    std::vector<double> yaw(time.size(), 0.1), pitch(time.size(), 0.05),
+                        roll(time.size(), -0.1);
+    AttitudeEvaluator evaluator(EulerAngles(time, yaw, pitch, roll));
+    ASSERT_TRUE(evaluator.uniform());
+
+    cartmat_t R = evaluator.rotmat(5.0);
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            ASSERT_NEAR(R_ypr_ref[i][j], R[i][j], tol);
+        }
+    }
+
+    double y, p, r;
+    evaluator.ypr(3.3, y, p, r);
+    ASSERT_NEAR(y, 0.1, tol);
+    ASSERT_NEAR(p, 0.05, tol);
+    ASSERT_NEAR(r, -0.1, tol);
+}
+
+TEST_F(AttitudeEvaluatorTest, SlerpSingleAxis) {
+    // Yaw rotating at a constant rate is reproduced exactly between samples
+    const double rate = 0.2;
+    std::vector<double> yaw, zeros(time.size(), 0.0);
+    for (double t : time) {
+        yaw.push_back(rate * t);
+    }
+    AttitudeEvaluator evaluator(EulerAngles(time, yaw, zeros, zeros));
+
+    for (double t : {0.0, 0.1, 2.71, 5.0, 9.99, 10.0}) {
+        double y, p, r;
+        evaluator.ypr(t, y, p, r);
+        ASSERT_NEAR(y, rate * t, tol);
+        ASSERT_NEAR(p, 0.0, tol);
+        ASSERT_NEAR(r, 0.0, tol);
+    }
+
+    // Times outside of the sampled span are clamped
+    double y, p, r;
+    evaluator.ypr(12.0, y, p, r);
+    ASSERT_NEAR(y, rate * 10.0, tol);
+}
+
+TEST_F(AttitudeEvaluatorTest, NonUniformTimes) {
+    // Quadratically spaced epochs with a roll rotating at a constant rate
+    const double rate = -0.05;
+    std::vector<double> times, qvec;
+    for (size_t i = 0; i < 15; ++i) {
+        const double t = 0.1 * i * i;
+        times.push_back(t);
+        // Alternate quaternion sign to exercise hemisphere continuity
+        const double s = (i % 2 == 0) ? 1.0 : -1.0;
+        qvec.push_back(s * std::cos(0.5 * rate * t));
+        qvec.push_back(s * std::sin(0.5 * rate * t));
+        qvec.push_back(0.0);
+        qvec.push_back(0.0);
+    }
+    AttitudeEvaluator evaluator(times, qvec);
+    ASSERT_FALSE(evaluator.uniform());
+
+    for (double t : {0.05, 1.3, 7.7, 19.6}) {
+        double y, p, r;
+        evaluator.ypr(t, y, p, r);
+        ASSERT_NEAR(y, 0.0, tol);
+        ASSERT_NEAR(p, 0.0, tol);
+        ASSERT_NEAR(r, rate * t, tol);
+    }
+}
+
+TEST_F(AttitudeEvaluatorTest, BatchEvaluation) {
+    std::vector<double> yaw, pitch, roll;
+    for (double t : time) {
+        yaw.push_back(0.1 + 0.01 * t);
+        pitch.push_back(0.05 - 0.002 * t * t);
+        roll.push_back(-0.1 + 0.03 * std::sin(t));
+    }
+    AttitudeEvaluator evaluator(EulerAngles(time, yaw, pitch, roll));
+
+    std::vector<double> queries = isce::core::linspace(-1.0, 11.0, 101);
+    std::vector<cartmat_t> R;
+    evaluator.rotmat(queries, R);
+    ASSERT_EQ(R.size(), queries.size());
+    for (size_t k = 0; k < queries.size(); ++k) {
+        cartmat_t Rk = evaluator.rotmat(queries[k]);
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                ASSERT_DOUBLE_EQ(Rk[i][j], R[k][i][j]);
+            }
+        }
+    }
+}
+
+TEST_F(AttitudeEvaluatorTest, InconsistentSizes) {
+    std::vector<double> qvec(4 * time.size() - 1, 0.0);
+    ASSERT_ANY_THROW(AttitudeEvaluator(time, qvec));
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+// end of file
@@ -16,6 +16,7 @@
 #include <complex>
 #include <vector>
 #include <random>
+#include <chrono>
 #include <gtest/gtest.h>
 
 // isce::core
@@ -314,6 +315,69 @@ TEST_F(Interp1dTest, Knab) {
     test_rand_offsets(0.998, 5.0, 0.5, 0.5, kernel);
 }
 
+TEST_F(Interp1dTest, Tabulated) {
+    auto knab = isce::core::KnabKernel<double>(9.0, 0.8);
+    auto linear = isce::core::TabulatedKernel<double>(knab, 2048);
+    auto cubic = isce::core::TabulatedKernel<double>(knab, 2048, true);
+
+    // Accuracy of table lookup against analytic kernel.
+    double errLinear = 0.0, errCubic = 0.0;
+    const double hw = knab.width() / 2;
+    for (size_t i=0; i<=10000; ++i) {
+        double x = -hw + 2 * hw * i / 10000.0;
+        errLinear = std::max(errLinear, std::abs(linear(x) - knab(x)));
+        errCubic = std::max(errCubic, std::abs(cubic(x) - knab(x)));
+    }
+    printf("max kernel error linear %g cubic %g\n", errLinear, errCubic);
+    EXPECT_LT(errLinear, 1e-5);
+    EXPECT_LT(errCubic, 1e-9);
+
+    // Zero outside the support of the kernel.
+    EXPECT_EQ(linear(hw + 0.01), 0.0);
+    EXPECT_EQ(cubic(-hw - 0.01), 0.0);
+    EXPECT_EQ(cubic(2 * hw), 0.0);
+
+    // Same quality requirements as the analytic kernel.
+    test_fixed_offset(0.999999, 0.001, 0.001, 0.001, linear,  0.0);
+    test_fixed_offset(0.998, 5.0, 1.0, 1.0, linear,  0.3);
+    test_rand_offsets(0.998, 5.0, 0.5, 0.5, linear);
+    test_rand_offsets(0.998, 5.0, 0.5, 0.5, cubic);
+}
+
+TEST_F(Interp1dTest, Batch) {
+    auto knab = isce::core::KnabKernel<double>(9.0, 0.8);
+    auto table = isce::core::TabulatedKernel<double>(knab, 2048, true);
+    auto rtimes = gen_rand_times();
+    std::valarray<double> times(rtimes.data(), rtimes.size());
+
+    // Repeat times to get a measurable run time.
+    const size_t nrep = 100;
+    std::valarray<double> many(nrep * times.size());
+    for (size_t i=0; i<nrep; ++i) {
+        many[std::slice(i * times.size(), times.size(), 1)] = times;
+    }
+
+    // Batched results must match point-wise interp1d for either kernel.
+    std::valarray<std::complex<double>> outKnab, outTable;
+    auto t0 = std::chrono::steady_clock::now();
+    interp1d(knab, signal, many, outKnab);
+    auto t1 = std::chrono::steady_clock::now();
+    interp1d(table, signal, many, outTable);
+    auto t2 = std::chrono::steady_clock::now();
+
+    double maxdiff = 0.0;
+    for (size_t i=0; i<times.size(); ++i) {
+        EXPECT_EQ(outKnab[i], interp1d(knab, signal, times[i]));
+        EXPECT_EQ(outTable[i], interp1d(table, &signal[0], n, 1, times[i]));
+        maxdiff = std::max(maxdiff, std::abs(outKnab[i] - outTable[i]));
+    }
+    EXPECT_LT(maxdiff, 1e-8);
+
+    printf("analytic %g s, tabulated %g s, max difference %g\n",
+           std::chrono::duration<double>(t1 - t0).count(),
+           std::chrono::duration<double>(t2 - t1).count(), maxdiff);
+}
+
 TEST_F(Interp1dTest, NFFT) {
     // FFT the signal set up by the test class to get a spectrum.
     std::valarray<std::complex<double>> spec(n);
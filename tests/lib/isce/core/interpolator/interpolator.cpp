@@ -441,6 +441,37 @@ TEST_F(InterpolatorTest, SimpleRampTest) {
     delete interp3;
 }
 
+// Test that separable weights reproduce interpolate()
+TEST_F(InterpolatorTest, SeparableWeights) {
+    const isce::core::dataInterpMethod methods[] = {
+        isce::core::NEAREST_METHOD, isce::core::BILINEAR_METHOD,
+        isce::core::BICUBIC_METHOD, isce::core::BIQUINTIC_METHOD,
+        isce::core::SINC_METHOD
+    };
+    size_t N_pts = true_values.length();
+    int ix[32], iy[32];
+    double wx[32], wy[32];
+    for (auto method : methods) {
+        isce::core::Interpolator<double> * interp =
+            isce::core::createInterpolator<double>(method);
+        const int taps = interp->taps();
+        ASSERT_GT(taps, 0);
+        for (size_t i = 0; i < N_pts; ++i) {
+            const double x = (true_values(i,0) - start) / delta;
+            const double y = (true_values(i,1) - start) / delta;
+            interp->weights(x, M.width(), ix, wx);
+            interp->weights(y, M.length(), iy, wy);
+            double z = 0.0;
+            for (int ii = 0; ii < taps; ++ii) {
+                for (int jj = 0; jj < taps; ++jj) {
+                    z += wy[ii] * wx[jj] * M(iy[ii], ix[jj]);
+                }
+            }
+            ASSERT_NEAR(z, interp->interpolate(x, y, M), 1.0e-10);
+        }
+        delete interp;
+    }
+}
 
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
@@ -53,6 +53,65 @@ TEST(LUT1dTest, Lookup) {
     }
 }
 
+TEST(LUT1dTest, UniformAndBatch) {
+
+    // Uniform coordinates with non-integer start and spacing
+    const size_t n = 37;
+    std::valarray<double> coords(n), values(n), jittered(n);
+    for (size_t i = 0; i < n; ++i) {
+        coords[i] = 850000.0 + 12.5 * i;
+        jittered[i] = coords[i] + ((i % 3 == 1) ? 0.3 : 0.0);
+        values[i] = std::sin(0.1 * i) + 0.01 * i * i;
+    }
+
+    // Same values on uniform and non-uniform coordinates
+    isce::core::LUT1d<double> lut(coords, values, true);
+    isce::core::LUT1d<double> lutJitter(jittered, values, true);
+    ASSERT_TRUE(lut.uniform());
+    ASSERT_FALSE(lutJitter.uniform());
+
+    // Reference LUT using binary search on the same coordinates; mutable access
+    // to the coordinates disables the uniform fast path
+    isce::core::LUT1d<double> lutSearch(lut);
+    std::valarray<double> & searchCoords = lutSearch.coords();
+    ASSERT_EQ(searchCoords.size(), n);
+    ASSERT_EQ(&searchCoords[0], &lutSearch.coords()[0]);
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(searchCoords[i], coords[i]);
+    }
+    ASSERT_FALSE(lutSearch.uniform());
+
+    // Evaluate on and between nodes, including extrapolation
+    std::vector<double> xvec = isce::core::linspace(849990.0, 850460.0, 377);
+    xvec.insert(xvec.end(), std::begin(coords), std::end(coords));
+    std::valarray<double> x(xvec.data(), xvec.size());
+    std::valarray<double> batch;
+    lut.evalBatch(x, batch);
+    for (size_t i = 0; i < x.size(); ++i) {
+        EXPECT_EQ(lut.eval(x[i]), lutSearch.eval(x[i]));
+        EXPECT_EQ(batch[i], lut.eval(x[i]));
+    }
+
+    // Node values are reproduced on non-uniform coordinates as well
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_NEAR(lutJitter.eval(jittered[i]), values[i], 1.0e-12);
+    }
+
+    // Batch on non-uniform coordinates, with unsorted points that force new
+    // searches as well as runs that reuse the previous interval
+    std::valarray<double> xj(x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+        xj[i] = x[(i * 7) % x.size()];
+    }
+    for (const std::valarray<double> * xs : {&x, &xj}) {
+        lutJitter.evalBatch(*xs, batch);
+        ASSERT_EQ(batch.size(), xs->size());
+        for (size_t i = 0; i < xs->size(); ++i) {
+            EXPECT_EQ(batch[i], lutJitter.eval((*xs)[i]));
+        }
+    }
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -60,6 +60,73 @@ TEST(LUT2dTest, Evaluation) {
     ASSERT_TRUE((error / N_pts) < 0.058);
 }
 
+// Test bilinear batch and row evaluation against point evaluation
+TEST(LUT2dTest, BatchEvaluation) {
+
+    // Doppler-like LUT over slant range (x) and azimuth time (y)
+    const size_t nx = 21, ny = 11;
+    isce::core::Matrix<double> M(ny, nx);
+    for (size_t i = 0; i < ny; ++i) {
+        for (size_t j = 0; j < nx; ++j) {
+            M(i,j) = 100.0 * std::cos(0.3 * j) + 5.0 * i * j - 2.0 * i;
+        }
+    }
+    const double x0 = 800000.0, dx = 1250.0, y0 = 100.0, dy = 0.5;
+    isce::core::LUT2d<double> lut(x0, y0, dx, dy, M,
+                                  isce::core::BILINEAR_METHOD, false);
+
+    // Range line covering the LUT and beyond its edges (clamped)
+    const size_t n = 613;
+    const double xs = x0 - 500.0, dxs = 43.7;
+    std::vector<double> out(n), row(n);
+    for (double y : {y0 - 1.0, y0, y0 + 1.3 * dy, y0 + 3.77, y0 + (ny - 1) * dy, 200.0}) {
+        std::vector<double> x(n);
+        for (size_t i = 0; i < n; ++i) {
+            x[i] = xs + i * dxs;
+        }
+        lut.evalBatch(y, x.data(), n, out.data());
+        lut.evalRow(y, xs, dxs, n, row.data());
+        for (size_t i = 0; i < n; ++i) {
+            const double ref = lut.eval(y, x[i]);
+            EXPECT_NEAR(out[i], ref, 1.0e-9);
+            EXPECT_EQ(row[i], out[i]);
+        }
+    }
+
+    // With bounds errors enabled, batch evaluation handles every point exactly
+    // as eval does: in-bounds points agree, and out-of-bounds points are
+    // reported and evaluate at the nearest edge, as the clamping LUT does
+    isce::core::LUT2d<double> strict(x0, y0, dx, dy, M,
+                                     isce::core::BILINEAR_METHOD, true);
+    std::vector<double> xin{x0, x0 + 3.3 * dx, x0 + (nx - 1) * dx};
+    for (double y : {y0, y0 + 2.2 * dy, y0 + (ny - 1) * dy}) {
+        strict.evalBatch(y, xin.data(), xin.size(), out.data());
+        for (size_t i = 0; i < xin.size(); ++i) {
+            EXPECT_NEAR(out[i], strict.eval(y, xin[i]), 1.0e-9);
+        }
+    }
+    double value = 0.0;
+    for (double xout : {x0 - 100.0, x0 + nx * dx}) {
+        EXPECT_EQ(strict.eval(y0, xout), lut.eval(y0, xout));
+        strict.evalBatch(y0, &xout, 1, &value);
+        EXPECT_EQ(value, lut.eval(y0, xout));
+    }
+    for (double yout : {y0 - dy, 200.0}) {
+        EXPECT_EQ(strict.eval(yout, x0), lut.eval(yout, x0));
+        strict.evalBatch(yout, &x0, 1, &value);
+        EXPECT_EQ(value, lut.eval(yout, x0));
+    }
+    EXPECT_EQ(strict.eval(y0 - dy, x0 - 100.0), M(0,0));
+    EXPECT_EQ(strict.eval(200.0, x0 + nx * dx), M(ny-1,nx-1));
+
+    // LUT without data returns the reference value
+    isce::core::LUT2d<double> empty;
+    double x[2] = {1.0, 2.0};
+    empty.evalBatch(0.0, x, 2, out.data());
+    EXPECT_EQ(out[0], 0.0);
+    EXPECT_EQ(out[1], 0.0);
+}
+
 void loadInterpData(isce::core::Matrix<double> & M) {
     /*
     Load ground truth interpolation data. The test data is the function:
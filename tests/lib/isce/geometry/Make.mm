@@ -18,6 +18,9 @@ PACKAGES = \
     topo \
     geo2rdr \
     rtc \
+    incidence \
+    baseline \
+    cube \
 
 # the standard targets
 all:
@@ -0,0 +1,162 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+
+#include <cmath>
+#include <valarray>
+#include <gtest/gtest.h>
+
+// isce::core
+#include "isce/core/Constants.h"
+#include "isce/core/Ellipsoid.h"
+#include "isce/core/LUT2d.h"
+#include "isce/core/Serialization.h"
+
+// isce::io
+#include "isce/io/IH5.h"
+
+// isce::product
+#include "isce/product/Product.h"
+#include "isce/product/RadarGridParameters.h"
+
+// isce::geometry
+#include "isce/geometry/BaselineGrid.h"
+#include "isce/geometry/DEMInterpolator.h"
+#include "isce/geometry/geometry.h"
+#include "isce/geometry/Serialization.h"
+
+using isce::core::Vec3;
+
+// Per-pixel baselines from rdr2geo on the reference and geo2rdr on the secondary
+void baselinesPixel(double aztime, double slantRange,
+                    const isce::core::Orbit & refOrbit,
+                    const isce::core::Orbit & secOrbit,
+                    const isce::core::Ellipsoid & ellps,
+                    double wavelength, int lookSide, double height,
+                    double & bperp, double & bpar) {
+
+    const isce::geometry::DEMInterpolator flatInterp(height);
+    isce::core::cartesian_t refPos, refVel, secPos, secVel;
+    refOrbit.interpolate(aztime, refPos, refVel, isce::core::HERMITE_METHOD);
+
+    isce::core::cartesian_t targetLLH{0.0, 0.0, height}, targetXYZ;
+    isce::geometry::rdr2geo(aztime, slantRange, 0, refOrbit, ellps, flatInterp,
+                            targetLLH, wavelength, lookSide, 1e-4, 20, 20,
+                            isce::core::HERMITE_METHOD);
+    ellps.lonLatToXyz(targetLLH, targetXYZ);
+
+    double secTime, secRange;
+    isce::core::LUT2d<double> zeroDoppler;
+    isce::geometry::geo2rdr(targetLLH, ellps, secOrbit, zeroDoppler, secTime, secRange,
+                            wavelength, 1e-8, 50, 10.0);
+    secOrbit.interpolate(secTime, secPos, secVel, isce::core::HERMITE_METHOD);
+
+    const Vec3 refLook = targetXYZ - refPos;
+    const Vec3 baseline = secPos - refPos;
+    bpar = (targetXYZ - secPos).norm() - refLook.norm();
+    const double sign = (refLook.cross(baseline).dot(refVel) >= 0.0) ? 1.0 : -1.0;
+    bperp = sign * std::sqrt(baseline.dot(baseline) - bpar * bpar);
+}
+
+struct BaselineGridTest : public ::testing::Test {
+
+    isce::io::IH5File file;
+    isce::product::Product product;
+    isce::product::RadarGridParameters radarGrid;
+    isce::core::Orbit refOrbit, secOrbit;
+    isce::core::Ellipsoid ellps;
+    int lookSide;
+
+    protected:
+
+        BaselineGridTest() :
+            file("../../data/envisat.h5"),
+            product(file),
+            radarGrid(product, 'A', 1, 1),
+            ellps(isce::core::EarthSemiMajorAxis, isce::core::EarthEccentricitySquared) {
+
+            refOrbit = product.metadata().orbit();
+            lookSide = product.lookSide();
+
+            // Secondary orbit displaced by a constant offset
+            secOrbit = refOrbit;
+            const double offset[3] = {120.0, -75.0, 60.0};
+            for (int i = 0; i < secOrbit.nVectors; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    secOrbit.position[3*i + j] += offset[j];
+                }
+            }
+        }
+};
+
+TEST_F(BaselineGridTest, MatchPerPixel) {
+
+    // Build grid
+    const std::vector<double> heights{-500.0, 0.0, 1000.0, 3000.0};
+    isce::geometry::BaselineGrid grid(radarGrid, heights, 50, 50);
+    grid.computeReferenceGeometry(refOrbit, ellps, lookSide, isce::core::HERMITE_METHOD);
+    grid.computeBaselines(secOrbit);
+    ASSERT_EQ(grid.orbitMethod(), isce::core::HERMITE_METHOD);
+    ASSERT_EQ(grid.length(), radarGrid.length());
+    ASSERT_EQ(grid.width(), radarGrid.width());
+
+    // Compare against per-pixel solves on a sparse set of lines
+    const double height = 500.0;
+    std::valarray<double> bperpLine, bparLine;
+    double maxPerpErr = 0.0, maxParErr = 0.0;
+    for (size_t line = 0; line < radarGrid.length(); line += radarGrid.length() / 7) {
+        grid.baselineLine(line, height, bperpLine, bparLine);
+        for (size_t rbin = 0; rbin < radarGrid.width(); rbin += 37) {
+            double bperp, bpar;
+            baselinesPixel(radarGrid.sensingTime(line), radarGrid.slantRange(rbin),
+                           refOrbit, secOrbit, ellps, radarGrid.wavelength(), lookSide,
+                           height, bperp, bpar);
+            maxPerpErr = std::max(maxPerpErr, std::abs(bperpLine[rbin] - bperp));
+            maxParErr = std::max(maxParErr, std::abs(bparLine[rbin] - bpar));
+
+            // Line and scalar queries agree
+            double p, q;
+            grid.baselines(line, rbin, height, p, q);
+            ASSERT_NEAR(p, bperpLine[rbin], 1.0e-6);
+            ASSERT_NEAR(q, bparLine[rbin], 1.0e-6);
+        }
+    }
+
+    ASSERT_LT(maxPerpErr, 0.05);
+    ASSERT_LT(maxParErr, 0.05);
+}
+
+TEST_F(BaselineGridTest, SaveAndLoadH5) {
+
+    const std::vector<double> heights{0.0, 1000.0};
+    isce::geometry::BaselineGrid grid(radarGrid, heights, 100, 100);
+    grid.computeReferenceGeometry(refOrbit, ellps, lookSide);
+    grid.computeBaselines(secOrbit);
+
+    // Write to a scratch file and read back
+    {
+        isce::io::IH5File out("baselineGrid.h5", 'x');
+        isce::io::IGroup group = out.openGroup("/");
+        isce::geometry::saveToH5(group, grid);
+    }
+    isce::io::IH5File in("baselineGrid.h5");
+    isce::io::IGroup group = in.openGroup("/");
+    isce::geometry::BaselineGrid loaded;
+    isce::geometry::loadFromH5(group, loaded);
+
+    ASSERT_EQ(loaded.length(), grid.length());
+    ASSERT_EQ(loaded.width(), grid.width());
+    ASSERT_EQ(loaded.coarseLength(), grid.coarseLength());
+    ASSERT_EQ(loaded.coarseWidth(), grid.coarseWidth());
+    const size_t ncells = heights.size() * grid.coarseLength() * grid.coarseWidth();
+    for (size_t i = 0; i < ncells; ++i) {
+        ASSERT_EQ(loaded.perpendicularBaseline()(i), grid.perpendicularBaseline()(i));
+        ASSERT_EQ(loaded.parallelBaseline()(i), grid.parallelBaseline()(i));
+    }
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+// end of file
@@ -0,0 +1,258 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+
+#include <cmath>
+#include <valarray>
+#include <gtest/gtest.h>
+
+// isce::core
+#include "isce/core/Constants.h"
+#include "isce/core/Ellipsoid.h"
+#include "isce/core/Serialization.h"
+
+// isce::io
+#include "isce/io/IH5.h"
+
+// isce::product
+#include "isce/product/Product.h"
+#include "isce/product/RadarGridParameters.h"
+
+// isce::geometry
+#include "isce/geometry/DEMInterpolator.h"
+#include "isce/geometry/GeometryCube.h"
+#include "isce/geometry/geometry.h"
+#include "isce/geometry/Serialization.h"
+
+using isce::geometry::GeometryCube;
+
+// Synthetic cube sampling: last coarse node falls on the last line and range bin
+const size_t synthLength = 1001, synthWidth = 801;
+const size_t synthAzDec = 100, synthRgDec = 80;
+const std::vector<double> synthHeights{-100.0, 0.0, 250.0, 1000.0};
+
+// Field that is linear in line, range bin and height
+double linearField(double line, double rbin, double height) {
+    return 3.0 + 0.25 * line - 0.04 * rbin + 0.002 * height;
+}
+
+// Field that no separable interpolator reproduces between nodes
+double nonlinearField(size_t k, size_t row, size_t col) {
+    return std::sin(0.9 * row) * std::cos(0.7 * col) + 0.1 * row * row + k;
+}
+
+// Cube with explicit sampling and X layer filled on the coarse nodes
+GeometryCube synthCube(double (*field)(size_t, size_t, size_t)) {
+    GeometryCube cube(0.0, 1.0, synthLength, 0.0, 1.0, synthWidth, synthHeights,
+                      synthAzDec, synthRgDec);
+    auto & layer = cube.layer(isce::geometry::CUBE_X);
+    for (size_t k = 0; k < synthHeights.size(); ++k) {
+        for (size_t row = 0; row < cube.coarseLength(); ++row) {
+            for (size_t col = 0; col < cube.coarseWidth(); ++col) {
+                layer(k, row, col) = field(k, row, col);
+            }
+        }
+    }
+    return cube;
+}
+
+double linearNode(size_t k, size_t row, size_t col) {
+    return linearField(row * synthAzDec, col * synthRgDec, synthHeights[k]);
+}
+
+struct GeometryCubeTest : public ::testing::Test {
+
+    isce::io::IH5File file;
+    isce::product::Product product;
+    isce::product::RadarGridParameters radarGrid;
+    isce::core::Orbit orbit;
+    isce::core::Ellipsoid ellps;
+    int lookSide;
+
+    protected:
+
+        GeometryCubeTest() :
+            file("../../data/envisat.h5"),
+            product(file),
+            radarGrid(product, 'A', 1, 1),
+            ellps(isce::core::EarthSemiMajorAxis, isce::core::EarthEccentricitySquared) {
+            orbit = product.metadata().orbit();
+            lookSide = product.lookSide();
+        }
+};
+
+TEST_F(GeometryCubeTest, NodesMatchRdr2geo) {
+
+    using namespace isce::geometry;
+
+    const std::vector<double> heights{-500.0, 0.0, 1500.0};
+    GeometryCube cube(radarGrid, heights, 200, 150);
+    cube.compute(orbit, ellps, lookSide);
+    ASSERT_EQ(cube.coarseAzimuthTime(0), radarGrid.sensingStart());
+    ASSERT_EQ(cube.coarseSlantRange(0), radarGrid.startingRange());
+
+    for (size_t k = 0; k < heights.size(); ++k) {
+        const DEMInterpolator flatInterp(heights[k]);
+        for (size_t row = 0; row < cube.coarseLength(); ++row) {
+            for (size_t col = 0; col < cube.coarseWidth(); ++col) {
+
+                // Independent zero-Doppler solve at the node
+                isce::core::cartesian_t targetLLH{0.0, 0.0, heights[k]};
+                rdr2geo(cube.coarseAzimuthTime(row), cube.coarseSlantRange(col), 0,
+                        orbit, ellps, flatInterp, targetLLH, radarGrid.wavelength(),
+                        lookSide, 1.0e-4, 20, 20, isce::core::HERMITE_METHOD);
+                ASSERT_NEAR(cube.layer(CUBE_X)(k, row, col),
+                            targetLLH[0] * 180.0 / M_PI, 1.0e-8);
+                ASSERT_NEAR(cube.layer(CUBE_Y)(k, row, col),
+                            targetLLH[1] * 180.0 / M_PI, 1.0e-8);
+
+                // Node values are returned at node positions
+                const double line = row * cube.azimuthDecimation();
+                const double rbin = col * cube.rangeDecimation();
+                ASSERT_NEAR(cube.evaluate(CUBE_X, line, rbin, heights[k]),
+                            cube.layer(CUBE_X)(k, row, col), 1.0e-9);
+            }
+        }
+    }
+}
+
+TEST_F(GeometryCubeTest, LayersConsistent) {
+
+    using namespace isce::geometry;
+
+    const std::vector<double> heights{0.0, 3000.0};
+    GeometryCube cube(radarGrid, heights, 150, 150);
+    cube.compute(orbit, ellps, lookSide);
+
+    const double degrees = 180.0 / M_PI;
+    for (size_t k = 0; k < heights.size(); ++k) {
+        for (size_t row = 0; row < cube.coarseLength(); ++row) {
+            for (size_t col = 0; col < cube.coarseWidth(); ++col) {
+                const double e = cube.layer(CUBE_LOS_EAST)(k, row, col);
+                const double n = cube.layer(CUBE_LOS_NORTH)(k, row, col);
+                const double u = cube.layer(CUBE_LOS_UP)(k, row, col);
+                const double inc = cube.layer(CUBE_INC)(k, row, col);
+                const double hdg = cube.layer(CUBE_HDG)(k, row, col);
+
+                // Unit vector pointing up to the sensor
+                ASSERT_NEAR(e * e + n * n + u * u, 1.0, 1.0e-12);
+                ASSERT_GT(u, 0.0);
+
+                // Incidence and azimuth angles follow from the unit vector
+                ASSERT_NEAR(std::cos(inc / degrees), u, 1.0e-12);
+                ASSERT_NEAR(hdg, std::atan2(n, e) * degrees - 90.0, 1.0e-9);
+            }
+        }
+
+        // Incidence grows with range
+        ASSERT_GT(cube.layer(CUBE_INC)(k, 0, cube.coarseWidth() - 1),
+                  cube.layer(CUBE_INC)(k, 0, 0));
+    }
+}
+
+TEST(GeometryCubeSynthetic, LinearFieldIsExact) {
+
+    using namespace isce::geometry;
+
+    GeometryCube cube = synthCube(linearNode);
+    for (auto method : {isce::core::BILINEAR_METHOD, isce::core::BICUBIC_METHOD,
+                        isce::core::BIQUINTIC_METHOD}) {
+        cube.interpMethod(method);
+        for (const double height : {-100.0, -37.5, 0.0, 600.0, 1000.0}) {
+
+            // Scalar queries, including both ends of each axis
+            for (const double line : {0.0, 0.4, 51.3, 499.9, 950.0, 1000.0}) {
+                for (const double rbin : {0.0, 0.7, 79.5, 400.2, 799.1, 800.0}) {
+                    ASSERT_NEAR(cube.evaluate(CUBE_X, line, rbin, height),
+                                linearField(line, rbin, height), 1.0e-9)
+                        << "method " << method << " line " << line << " rbin " << rbin;
+                }
+            }
+
+            // Line queries
+            std::valarray<double> values;
+            for (const size_t line : {0, 333, 1000}) {
+                cube.evaluateLine(CUBE_X, line, height, values);
+                ASSERT_EQ(values.size(), synthWidth);
+                for (size_t rbin = 0; rbin < synthWidth; ++rbin) {
+                    ASSERT_NEAR(values[rbin], linearField(line, rbin, height), 1.0e-9);
+                }
+            }
+        }
+    }
+}
+
+TEST(GeometryCubeSynthetic, SplineAtEndNodes) {
+
+    using namespace isce::geometry;
+
+    GeometryCube cube = synthCube(nonlinearField);
+    cube.interpMethod(isce::core::BIQUINTIC_METHOD);
+    const size_t lastRow = cube.coarseLength() - 1;
+    const size_t lastCol = cube.coarseWidth() - 1;
+
+    // An interpolating spline returns the node value at every node, in
+    // particular the first and last nodes of each axis
+    for (size_t k = 0; k < synthHeights.size(); ++k) {
+        for (const size_t row : {(size_t) 0, (size_t) 1, lastRow - 1, lastRow}) {
+            for (const size_t col : {(size_t) 0, (size_t) 1, lastCol - 1, lastCol}) {
+                const double line = row * synthAzDec;
+                const double rbin = col * synthRgDec;
+                ASSERT_NEAR(cube.evaluate(CUBE_X, line, rbin, synthHeights[k]),
+                            nonlinearField(k, row, col), 1.0e-10)
+                    << "row " << row << " col " << col;
+            }
+        }
+
+        // Line queries agree with scalar queries
+        std::valarray<double> values;
+        for (const size_t line : {(size_t) 0, lastRow * synthAzDec}) {
+            cube.evaluateLine(CUBE_X, line, synthHeights[k], values);
+            for (size_t rbin = 0; rbin < synthWidth; rbin += 10) {
+                ASSERT_NEAR(values[rbin],
+                            cube.evaluate(CUBE_X, line, rbin, synthHeights[k]), 1.0e-10);
+            }
+        }
+    }
+}
+
+TEST(GeometryCubeSynthetic, SaveAndLoadH5) {
+
+    using namespace isce::geometry;
+
+    GeometryCube cube = synthCube(nonlinearField);
+
+    // Write to a scratch file and read back
+    {
+        isce::io::IH5File out("geometryCube.h5", 'x');
+        isce::io::IGroup group = out.openGroup("/");
+        saveToH5(group, cube);
+    }
+    isce::io::IH5File in("geometryCube.h5");
+    isce::io::IGroup group = in.openGroup("/");
+    GeometryCube loaded;
+    loadFromH5(group, loaded);
+
+    ASSERT_EQ(loaded.length(), cube.length());
+    ASSERT_EQ(loaded.width(), cube.width());
+    ASSERT_EQ(loaded.azimuthDecimation(), cube.azimuthDecimation());
+    ASSERT_EQ(loaded.rangeDecimation(), cube.rangeDecimation());
+    ASSERT_EQ(loaded.epsg(), cube.epsg());
+    ASSERT_EQ(loaded.heights(), cube.heights());
+
+    // Same values anywhere on the grid
+    for (const double height : {-100.0, 125.0, 1000.0}) {
+        for (const double line : {0.0, 123.4, 1000.0}) {
+            for (const double rbin : {0.0, 456.7, 800.0}) {
+                ASSERT_EQ(loaded.evaluate(CUBE_X, line, rbin, height),
+                          cube.evaluate(CUBE_X, line, rbin, height));
+            }
+        }
+    }
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+// end of file
@@ -10,6 +10,7 @@ include isce.def
 # the pile of tests
 TESTS = \
     geo2rdr \
+    geo2rdrstack \
 
 all: test clean
 
@@ -22,7 +23,10 @@ test: $(TESTS)
             } done
 
 # build
-PROJ_CLEAN += $(TESTS) range.off range.off.xml azimuth.off azimuth.off.xml
+PROJ_CLEAN += $(TESTS) range.off range.off.xml azimuth.off azimuth.off.xml \
+    fusedRange.off fusedRange.off.xml fusedAzimuth.off fusedAzimuth.off.xml \
+    stack0Range.off stack0Range.off.xml stack0Azimuth.off stack0Azimuth.off.xml \
+    stack1Range.off stack1Range.off.xml stack1Azimuth.off stack1Azimuth.off.xml
 PROJ_CXX_INCLUDES += $(EXPORT_ROOT)/include/$(PROJECT)-$(PROJECT_MAJOR).$(PROJECT_MINOR)
 PROJ_LIBRARIES = -lisce.$(PROJECT_MAJOR).$(PROJECT_MINOR) -lgtest
 LIBRARIES = $(PROJ_LIBRARIES) $(EXTERNAL_LIBS)
@@ -10,6 +10,7 @@
 #include <string>
 #include <sstream>
 #include <fstream>
+#include <sys/stat.h>
 #include <gtest/gtest.h>
 
 // isce::core
@@ -25,6 +26,7 @@
 // isce::geometry
 #include "isce/geometry/Serialization.h"
 #include "isce/geometry/Geo2rdr.h"
+#include "isce/geometry/Topo.h"
 
 TEST(Geo2rdrTest, RunGeo2rdr) {
 
@@ -79,6 +81,130 @@ TEST(Geo2rdrTest, CheckResults) {
     ASSERT_TRUE(az_error < 1.0e-10);
 }
 
+// Topo of the product fused with geo2rdr of the same product
+TEST(Geo2rdrTest, RunFusedTopoGeo2rdr) {
+
+    // Open the HDF5 product
+    std::string h5file("../../data/envisat.h5");
+    isce::io::IH5File file(h5file);
+    isce::product::Product product(file);
+
+    // Create and configure topo and geo2rdr instances
+    isce::geometry::Topo topo(product, 'A', true);
+    isce::geometry::Geo2rdr geo(product, 'A', true);
+    {
+    std::ifstream xmlfid("../../data/topo.xml", std::ios::in);
+    cereal::XMLInputArchive archive(xmlfid);
+    archive(cereal::make_nvp("Topo", topo));
+    }
+    {
+    std::ifstream xmlfid("../../data/topo.xml", std::ios::in);
+    cereal::XMLInputArchive archive(xmlfid);
+    archive(cereal::make_nvp("Geo2rdr", geo));
+    }
+
+    // Open DEM raster
+    isce::io::Raster demRaster("../../data/srtm_cropped.tif");
+
+    // Offset rasters on the reference radar grid; no topo layers are written
+    const size_t width = topo.radarGridParameters().width();
+    const size_t length = topo.radarGridParameters().length();
+    isce::io::Raster rgoffRaster("fusedRange.off", width, length, 1, GDT_Float32, "ISCE");
+    isce::io::Raster azoffRaster("fusedAzimuth.off", width, length, 1, GDT_Float32, "ISCE");
+    isce::geometry::TopoLayers layers;
+    layers.selection(0);
+
+    // Run fused topo and geo2rdr
+    topo.topo(demRaster, layers, geo, rgoffRaster, azoffRaster);
+}
+
+// Fused results should also be very close to zero
+TEST(Geo2rdrTest, CheckFusedResults) {
+    isce::io::Raster rgoffRaster("fusedRange.off");
+    isce::io::Raster azoffRaster("fusedAzimuth.off");
+    double rg_error = 0.0;
+    double az_error = 0.0;
+    size_t count = 0;
+    for (size_t i = 0; i < rgoffRaster.length(); ++i) {
+        for (size_t j = 0; j < rgoffRaster.width(); ++j) {
+            double rgoff, azoff;
+            rgoffRaster.getValue(rgoff, j, i);
+            azoffRaster.getValue(azoff, j, i);
+            if (std::abs(rgoff) > 999.0 || std::abs(azoff) > 999.0)
+                continue;
+            rg_error += rgoff*rgoff;
+            az_error += azoff*azoff;
+            ++count;
+        }
+    }
+    ASSERT_TRUE(count > 0);
+    ASSERT_TRUE(rg_error < 1.0e-10);
+    ASSERT_TRUE(az_error < 1.0e-10);
+}
+
+// Geo2rdr of a topo run that only wrote some of the layers
+TEST(Geo2rdrTest, SubsetTopoGeo2rdr) {
+
+    // Open the HDF5 product
+    std::string h5file("../../data/envisat.h5");
+    isce::io::IH5File file(h5file);
+    isce::product::Product product(file);
+
+    // Create and configure topo and geo2rdr instances
+    isce::geometry::Topo topo(product, 'A', true);
+    isce::geometry::Geo2rdr geo(product, 'A', true);
+    {
+    std::ifstream xmlfid("../../data/topo.xml", std::ios::in);
+    cereal::XMLInputArchive archive(xmlfid);
+    archive(cereal::make_nvp("Topo", topo));
+    }
+    {
+    std::ifstream xmlfid("../../data/topo.xml", std::ios::in);
+    cereal::XMLInputArchive archive(xmlfid);
+    archive(cereal::make_nvp("Geo2rdr", geo));
+    }
+    isce::io::Raster demRaster("../../data/srtm_cropped.tif");
+
+    // x/y/z stay in bands 1-3 of topo.vrt when other layers are dropped
+    mkdir("subsetTopo", 0755);
+    topo.outputLayers(isce::geometry::TOPO_XYZ | isce::geometry::TOPO_LOCALINC);
+    topo.topo(demRaster, "subsetTopo");
+    {
+    isce::io::Raster topoRaster("subsetTopo/topo.vrt");
+    ASSERT_EQ(topoRaster.numBands(), 4u);
+    geo.geo2rdr(topoRaster, "subsetTopo");
+    }
+
+    isce::io::Raster rgoffRaster("subsetTopo/range.off");
+    isce::io::Raster azoffRaster("subsetTopo/azimuth.off");
+    double rg_error = 0.0;
+    double az_error = 0.0;
+    size_t count = 0;
+    for (size_t i = 0; i < rgoffRaster.length(); ++i) {
+        for (size_t j = 0; j < rgoffRaster.width(); ++j) {
+            double rgoff, azoff;
+            rgoffRaster.getValue(rgoff, j, i);
+            azoffRaster.getValue(azoff, j, i);
+            if (std::abs(rgoff) > 999.0 || std::abs(azoff) > 999.0)
+                continue;
+            rg_error += rgoff*rgoff;
+            az_error += azoff*azoff;
+            ++count;
+        }
+    }
+    ASSERT_TRUE(count > 0);
+    ASSERT_TRUE(rg_error < 1.0e-10);
+    ASSERT_TRUE(az_error < 1.0e-10);
+
+    // Without all of x/y/z no topo.vrt is written
+    mkdir("noXYZTopo", 0755);
+    topo.outputLayers(isce::geometry::TOPO_Z | isce::geometry::TOPO_INC);
+    topo.topo(demRaster, "noXYZTopo");
+    struct stat info;
+    ASSERT_EQ(stat("noXYZTopo/z.rdr", &info), 0);
+    ASSERT_NE(stat("noXYZTopo/topo.vrt", &info), 0);
+}
+
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
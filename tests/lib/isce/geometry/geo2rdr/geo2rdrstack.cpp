@@ -0,0 +1,97 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+//
+
+#include <cmath>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+// isce::core
+#include "isce/core/Constants.h"
+
+// isce::io
+#include "isce/io/IH5.h"
+#include "isce/io/Raster.h"
+
+// isce::product
+#include "isce/product/Product.h"
+#include "isce/product/RadarGridParameters.h"
+
+// isce::geometry
+#include "isce/geometry/Geo2rdrStack.h"
+
+TEST(Geo2rdrStackTest, RunGeo2rdrStack) {
+
+    // Open the HDF5 product
+    std::string h5file("../../data/envisat.h5");
+    isce::io::IH5File file(h5file);
+    isce::product::Product product(file);
+
+    // Radar grid of the product and the same grid starting ten lines later
+    const isce::product::RadarGridParameters grid(product, 'A', 1, 1);
+    const isce::product::RadarGridParameters shifted(
+        1, 1, grid.sensingStart() + 10.0 / grid.prf(), grid.wavelength(), grid.prf(),
+        grid.startingRange(), grid.rangePixelSpacing(), grid.length(), grid.width(),
+        grid.refEpoch());
+
+    // Stack of two secondaries with the native Doppler of the product
+    const isce::core::LUT2d<double> & doppler =
+        product.metadata().procInfo().dopplerCentroid('A');
+    isce::geometry::Geo2rdrStack stack(
+        isce::core::Ellipsoid(isce::core::EarthSemiMajorAxis,
+                              isce::core::EarthEccentricitySquared));
+    stack.threshold(1.0e-9);
+    stack.numiter(50);
+    stack.addSecondary(grid, product.metadata().orbit(), doppler);
+    stack.addSecondary(shifted, product.metadata().orbit(), doppler);
+    ASSERT_EQ(stack.numSecondaries(), 2);
+
+    // Open topo raster from topo unit test
+    isce::io::Raster topoRaster("../topo/topo.vrt");
+
+    // Run geo2rdr for the stack
+    std::vector<isce::io::Raster> rgoffRasters, azoffRasters;
+    for (const std::string name : {"stack0", "stack1"}) {
+        rgoffRasters.push_back(isce::io::Raster(name + "Range.off", topoRaster.width(),
+            topoRaster.length(), 1, GDT_Float32, "ISCE"));
+        azoffRasters.push_back(isce::io::Raster(name + "Azimuth.off", topoRaster.width(),
+            topoRaster.length(), 1, GDT_Float32, "ISCE"));
+    }
+    stack.geo2rdr(topoRaster, rgoffRasters, azoffRasters);
+}
+
+// First secondary matches single geo2rdr; second is offset by ten lines
+TEST(Geo2rdrStackTest, CheckResults) {
+    isce::io::Raster rgoffRef("range.off"), azoffRef("azimuth.off");
+    isce::io::Raster rgoff0("stack0Range.off"), azoff0("stack0Azimuth.off");
+    isce::io::Raster rgoff1("stack1Range.off"), azoff1("stack1Azimuth.off");
+    size_t count = 0;
+    for (size_t i = 0; i < rgoffRef.length(); ++i) {
+        for (size_t j = 0; j < rgoffRef.width(); ++j) {
+            double rgRef, azRef, rg0, az0, rg1, az1;
+            rgoffRef.getValue(rgRef, j, i);
+            azoffRef.getValue(azRef, j, i);
+            rgoff0.getValue(rg0, j, i);
+            azoff0.getValue(az0, j, i);
+            ASSERT_NEAR(rg0, rgRef, 1.0e-6);
+            ASSERT_NEAR(az0, azRef, 1.0e-6);
+            // Skip null values
+            rgoff1.getValue(rg1, j, i);
+            azoff1.getValue(az1, j, i);
+            if (std::abs(rg1) > 999.0 || std::abs(az1) > 999.0 || std::abs(az0) > 999.0)
+                continue;
+            ASSERT_NEAR(rg1, rg0, 1.0e-6);
+            ASSERT_NEAR(az1, az0 - 10.0, 1.0e-4);
+            ++count;
+        }
+    }
+    ASSERT_TRUE(count > 0);
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+// end of file
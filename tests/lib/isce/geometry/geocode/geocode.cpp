@@ -30,6 +30,7 @@
 #include "isce/geometry/Topo.h"
 
 #include <isce/geometry/Geocode.h>
+#include <isce/geometry/GeocodeLookupTable.h>
 
 // Declaration for utility function to read metadata stream from VRT
 std::stringstream streamFromVRT(const char * filename, int bandNum=1);
@@ -213,6 +214,274 @@ TEST(GeocodeTest, CheckGeocode) {
 
 }
 
+TEST(GeocodeTest, TiledGeocode) {
+
+    // Geocoding with 2D tiles must reproduce the full-width block result
+    isce::io::IH5File file("../../data/envisat.h5");
+    isce::product::Product product(file);
+
+    const isce::product::Swath & swath = product.swath('A');
+    isce::core::Orbit orbit = product.metadata().orbit();
+    isce::core::Ellipsoid ellipsoid;
+    isce::core::LUT2d<double> doppler = product.metadata().procInfo().dopplerCentroid('A');
+
+    isce::io::Raster demRaster("zeroHeightDEM.geo");
+    isce::io::Raster radarRaster("x.rdr");
+    isce::io::Raster refRaster("x.geo");
+    const int geoGridLength = refRaster.length();
+    const int geoGridWidth = refRaster.width();
+    isce::io::Raster tiledRaster("x_tiled.geo", geoGridWidth, geoGridLength,
+                                 1, GDT_Float64, "ENVI");
+
+    // Same configuration as RunGeocode with 128 x 100 tiles
+    isce::geometry::Geocode<double> geoObj;
+    geoObj.orbit(orbit);
+    geoObj.ellipsoid(ellipsoid);
+    geoObj.thresholdGeo2rdr(1.0e-9);
+    geoObj.numiterGeo2rdr(25);
+    geoObj.linesPerBlock(100);
+    geoObj.columnsPerBlock(128);
+    geoObj.demBlockMargin(0.1);
+    geoObj.radarBlockMargin(10);
+    geoObj.interpolator(isce::core::BIQUINTIC_METHOD);
+    geoObj.radarGrid(doppler, orbit.refEpoch, swath.zeroDopplerTime()[0],
+                     1.0/swath.nominalAcquisitionPRF(), radarRaster.length(),
+                     swath.slantRange()[0], swath.rangePixelSpacing(),
+                     swath.processedWavelength(), radarRaster.width(),
+                     product.lookSide());
+    geoObj.geoGrid(-115.65, 34.84, 0.0002, -8.0e-5, geoGridWidth, geoGridLength, 4326);
+    geoObj.geocode(radarRaster, tiledRaster, demRaster);
+
+    std::valarray<double> ref(geoGridLength*geoGridWidth);
+    std::valarray<double> tiled(geoGridLength*geoGridWidth);
+    refRaster.getBlock(ref, 0, 0, geoGridWidth, geoGridLength);
+    tiledRaster.getBlock(tiled, 0, 0, geoGridWidth, geoGridLength);
+
+    double maxErr = 0.0;
+    for (size_t i = 0; i < ref.size(); ++i) {
+        maxErr = std::max(maxErr, std::abs(ref[i] - tiled[i]));
+    }
+    ASSERT_LT(maxErr, 1.0e-12);
+}
+
+TEST(GeocodeTest, MultiBandGeocode) {
+
+    // Geocoding a two-band raster with weights shared across bands must
+    // reproduce single-band geocoding of each band, for a polynomial kernel
+    // and for the sinc kernel
+    isce::io::IH5File file("../../data/envisat.h5");
+    isce::product::Product product(file);
+
+    const isce::product::Swath & swath = product.swath('A');
+    isce::core::Orbit orbit = product.metadata().orbit();
+    isce::core::Ellipsoid ellipsoid;
+    isce::core::LUT2d<double> doppler = product.metadata().procInfo().dopplerCentroid('A');
+
+    isce::io::Raster demRaster("zeroHeightDEM.geo");
+    std::vector<isce::io::Raster> bandRasters{isce::io::Raster("x.rdr"),
+                                              isce::io::Raster("y.rdr")};
+    isce::io::Raster radarRaster("xy.vrt", bandRasters);
+    ASSERT_EQ(radarRaster.numBands(), 2u);
+
+    // Same grid as RunGeocode
+    isce::io::Raster xRefRaster("x.geo");
+    const int geoGridLength = xRefRaster.length();
+    const int geoGridWidth = xRefRaster.width();
+
+    for (auto method : {isce::core::BIQUINTIC_METHOD, isce::core::SINC_METHOD}) {
+
+        // Same configuration as RunGeocode apart from the interpolator
+        isce::geometry::Geocode<double> geoObj;
+        geoObj.orbit(orbit);
+        geoObj.ellipsoid(ellipsoid);
+        geoObj.thresholdGeo2rdr(1.0e-9);
+        geoObj.numiterGeo2rdr(25);
+        geoObj.linesPerBlock(1000);
+        geoObj.demBlockMargin(0.1);
+        geoObj.radarBlockMargin(10);
+        geoObj.interpolator(method);
+        geoObj.radarGrid(doppler, orbit.refEpoch, swath.zeroDopplerTime()[0],
+                         1.0/swath.nominalAcquisitionPRF(), radarRaster.length(),
+                         swath.slantRange()[0], swath.rangePixelSpacing(),
+                         swath.processedWavelength(), radarRaster.width(),
+                         product.lookSide());
+        geoObj.geoGrid(-115.65, 34.84, 0.0002, -8.0e-5, geoGridWidth, geoGridLength, 4326);
+
+        // Single-band references with the same interpolator
+        const std::string suffix = std::to_string(method);
+        std::vector<isce::io::Raster> refRasters;
+        for (size_t band = 0; band < 2; ++band) {
+            refRasters.emplace_back((band == 0 ? "x_" : "y_") + suffix + ".geo",
+                                    geoGridWidth, geoGridLength, 1, GDT_Float64, "ENVI");
+            geoObj.geocode(bandRasters[band], refRasters.back(), demRaster);
+        }
+
+        isce::io::Raster geocodedRaster("xy_" + suffix + ".geo", geoGridWidth,
+                                        geoGridLength, 2, GDT_Float64, "ENVI");
+        geoObj.geocode(radarRaster, geocodedRaster, demRaster);
+
+        // Each band matches its single-band result, including invalid pixels
+        std::valarray<double> ref(geoGridLength*geoGridWidth), val(geoGridLength*geoGridWidth);
+        for (size_t band = 1; band <= 2; ++band) {
+            refRasters[band - 1].getBlock(ref, 0, 0, geoGridWidth, geoGridLength);
+            geocodedRaster.getBlock(val, 0, 0, geoGridWidth, geoGridLength, band);
+            size_t nvalid = 0;
+            for (size_t i = 0; i < ref.size(); ++i) {
+                ASSERT_EQ(ref[i] == 0.0, val[i] == 0.0);
+                nvalid += (ref[i] != 0.0);
+                ASSERT_NEAR(val[i], ref[i], 1.0e-9);
+            }
+            ASSERT_GT(nvalid, 0u);
+        }
+    }
+}
+
+TEST(GeocodeTest, LookupTableInterpolation) {
+
+    // Decimated table of a linear mapping is reproduced exactly
+    isce::geometry::GeocodeLookupTable lut(-115.65, 34.84, 0.0002, -8.0e-5,
+                                           37, 22, 4326, 4);
+    ASSERT_EQ(lut.coarseWidth(), 10);
+    ASSERT_EQ(lut.coarseLength(), 7);
+    for (size_t row = 0; row < lut.coarseLength(); ++row) {
+        for (size_t col = 0; col < lut.coarseWidth(); ++col) {
+            lut.radarLine()(row, col) = 100.0 + 0.5 * row * 4 + 0.25 * col * 4;
+            lut.radarPixel()(row, col) = 50.0 - 0.125 * row * 4 + 2.0 * col * 4;
+        }
+    }
+    for (size_t line = 0; line < lut.length(); ++line) {
+        for (size_t pixel = 0; pixel < lut.width(); ++pixel) {
+            double y, x;
+            lut.radarCoordinates(line, pixel, y, x);
+            ASSERT_NEAR(y, 100.0 + 0.5 * line + 0.25 * pixel, 1.0e-9);
+            ASSERT_NEAR(x, 50.0 - 0.125 * line + 2.0 * pixel, 1.0e-9);
+        }
+    }
+
+    // Bounding box of a block encloses all of its pixels
+    double firstLine, lastLine, firstPixel, lastPixel;
+    ASSERT_TRUE(lut.radarBoundingBox(5, 6, 9, 10, firstLine, lastLine,
+                                     firstPixel, lastPixel));
+    ASSERT_LE(firstLine, 100.0 + 0.5 * 5 + 0.25 * 9);
+    ASSERT_GE(lastLine, 100.0 + 0.5 * 10 + 0.25 * 18);
+    ASSERT_LE(firstPixel, 50.0 - 0.125 * 10 + 2.0 * 9);
+    ASSERT_GE(lastPixel, 50.0 - 0.125 * 5 + 2.0 * 18);
+}
+
+TEST(GeocodeTest, LookupTableSaveAndLoadH5) {
+
+    // Decimated table with distinct values at every coarse node
+    isce::geometry::GeocodeLookupTable lut(-115.65, 34.84, 0.0002, -8.0e-5,
+                                           37, 22, 4326, 4);
+    for (size_t row = 0; row < lut.coarseLength(); ++row) {
+        for (size_t col = 0; col < lut.coarseWidth(); ++col) {
+            lut.radarLine()(row, col) = 100.0 + 0.5 * row + 0.03125 * col;
+            lut.radarPixel()(row, col) = 50.0 - 0.125 * row + 2.25 * col;
+        }
+    }
+
+    // Write to a scratch file and read back
+    {
+        isce::io::IH5File out("lookupTable.h5", 'x');
+        isce::io::IGroup group = out.openGroup("/");
+        isce::geometry::saveToH5(group, lut);
+    }
+    isce::io::IH5File in("lookupTable.h5");
+    isce::io::IGroup group = in.openGroup("/");
+    isce::geometry::GeocodeLookupTable loaded;
+    isce::geometry::loadFromH5(group, loaded);
+
+    // Grid metadata
+    ASSERT_EQ(loaded.geoGridStartX(), lut.geoGridStartX());
+    ASSERT_EQ(loaded.geoGridStartY(), lut.geoGridStartY());
+    ASSERT_EQ(loaded.geoGridSpacingX(), lut.geoGridSpacingX());
+    ASSERT_EQ(loaded.geoGridSpacingY(), lut.geoGridSpacingY());
+    ASSERT_EQ(loaded.width(), lut.width());
+    ASSERT_EQ(loaded.length(), lut.length());
+    ASSERT_EQ(loaded.epsg(), lut.epsg());
+    ASSERT_EQ(loaded.decimation(), lut.decimation());
+
+    // Coarse radar coordinates
+    ASSERT_EQ(loaded.coarseWidth(), lut.coarseWidth());
+    ASSERT_EQ(loaded.coarseLength(), lut.coarseLength());
+    for (size_t row = 0; row < lut.coarseLength(); ++row) {
+        for (size_t col = 0; col < lut.coarseWidth(); ++col) {
+            ASSERT_EQ(loaded.radarLine()(row, col), lut.radarLine()(row, col));
+            ASSERT_EQ(loaded.radarPixel()(row, col), lut.radarPixel()(row, col));
+        }
+    }
+}
+
+TEST(GeocodeTest, LookupTableGeocode) {
+
+    // Geocoding from a precomputed lookup table must match direct geocoding
+    isce::io::IH5File file("../../data/envisat.h5");
+    isce::product::Product product(file);
+
+    const isce::product::Swath & swath = product.swath('A');
+    isce::core::Orbit orbit = product.metadata().orbit();
+    isce::core::Ellipsoid ellipsoid;
+    isce::core::LUT2d<double> doppler = product.metadata().procInfo().dopplerCentroid('A');
+
+    isce::io::Raster demRaster("zeroHeightDEM.geo");
+    isce::io::Raster xRaster("x.rdr");
+    isce::io::Raster yRaster("y.rdr");
+    isce::io::Raster xRefRaster("x.geo");
+    isce::io::Raster yRefRaster("y.geo");
+    const int geoGridLength = xRefRaster.length();
+    const int geoGridWidth = xRefRaster.width();
+
+    isce::geometry::Geocode<double> geoObj;
+    geoObj.orbit(orbit);
+    geoObj.ellipsoid(ellipsoid);
+    geoObj.thresholdGeo2rdr(1.0e-9);
+    geoObj.numiterGeo2rdr(25);
+    geoObj.linesPerBlock(1000);
+    geoObj.demBlockMargin(0.1);
+    geoObj.radarBlockMargin(10);
+    geoObj.interpolator(isce::core::BIQUINTIC_METHOD);
+    geoObj.radarGrid(doppler, orbit.refEpoch, swath.zeroDopplerTime()[0],
+                     1.0/swath.nominalAcquisitionPRF(), xRaster.length(),
+                     swath.slantRange()[0], swath.rangePixelSpacing(),
+                     swath.processedWavelength(), xRaster.width(),
+                     product.lookSide());
+    geoObj.geoGrid(-115.65, 34.84, 0.0002, -8.0e-5, geoGridWidth, geoGridLength, 4326);
+
+    for (size_t decimation : {1, 8}) {
+
+        // Compute the lookup table once and geocode both rasters in one pass
+        isce::geometry::GeocodeLookupTable lut;
+        geoObj.computeLookupTable(demRaster, lut, decimation);
+        ASSERT_EQ(lut.width(), geoGridWidth);
+        ASSERT_EQ(lut.length(), geoGridLength);
+
+        const std::string suffix = "_lut" + std::to_string(decimation) + ".geo";
+        std::vector<isce::io::Raster> inputs{xRaster, yRaster};
+        std::vector<isce::io::Raster> outputs{
+            isce::io::Raster("x" + suffix, geoGridWidth, geoGridLength, 1, GDT_Float64, "ENVI"),
+            isce::io::Raster("y" + suffix, geoGridWidth, geoGridLength, 1, GDT_Float64, "ENVI")
+        };
+        geoObj.geocode(inputs, outputs, lut);
+
+        // Compare pixels valid in both
+        std::valarray<double> ref(geoGridLength*geoGridWidth), val(geoGridLength*geoGridWidth);
+        for (size_t k = 0; k < 2; ++k) {
+            (k == 0 ? xRefRaster : yRefRaster).getBlock(ref, 0, 0, geoGridWidth, geoGridLength);
+            outputs[k].getBlock(val, 0, 0, geoGridWidth, geoGridLength);
+            double maxErr = 0.0;
+            size_t nref = 0, nval = 0;
+            for (size_t i = 0; i < ref.size(); ++i) {
+                nref += (ref[i] != 0.0);
+                nval += (val[i] != 0.0);
+                if (ref[i] != 0.0 && val[i] != 0.0)
+                    maxErr = std::max(maxErr, std::abs(ref[i] - val[i]));
+            }
+            ASSERT_LT(maxErr, 1.0e-6);
+            ASSERT_NEAR(nval, nref, 0.01 * nref);
+        }
+    }
+}
+
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
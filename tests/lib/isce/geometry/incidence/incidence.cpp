@@ -0,0 +1,95 @@
+//-*- C++ -*-
+//-*- coding: utf-8 -*-
+
+#include <cmath>
+#include <valarray>
+#include <gtest/gtest.h>
+
+// isce::core
+#include "isce/core/Constants.h"
+#include "isce/core/Ellipsoid.h"
+#include "isce/core/Serialization.h"
+
+// isce::io
+#include "isce/io/IH5.h"
+
+// isce::product
+#include "isce/product/Product.h"
+#include "isce/product/RadarGridParameters.h"
+
+// isce::geometry
+#include "isce/geometry/DEMInterpolator.h"
+#include "isce/geometry/geometry.h"
+#include "isce/geometry/IncidenceAngleTable.h"
+
+using isce::core::Mat3;
+using isce::core::Vec3;
+
+// Per-pixel flat-earth sine of incidence angle
+double sinIncidencePixel(double aztime, double slantRange,
+                         const isce::core::Orbit & orbit,
+                         const isce::core::Ellipsoid & ellps,
+                         const isce::geometry::DEMInterpolator & flatInterp,
+                         double wavelength, int lookSide, double height) {
+
+    isce::core::cartesian_t xyzPlat, vel;
+    orbit.interpolateWGS84Orbit(aztime, xyzPlat, vel);
+
+    isce::core::cartesian_t targetLLH{0.0, 0.0, height}, targetXYZ;
+    isce::geometry::rdr2geo(aztime, slantRange, 0, orbit, ellps, flatInterp,
+                            targetLLH, wavelength, lookSide, 1e-4, 20, 20,
+                            isce::core::HERMITE_METHOD);
+
+    ellps.lonLatToXyz(targetLLH, targetXYZ);
+    const Vec3 satToGround = targetXYZ - xyzPlat;
+    const Mat3 xyz2enu = Mat3::xyzToEnu(targetLLH[1], targetLLH[0]);
+    const Vec3 enu = xyz2enu.dot(satToGround);
+    const double costheta = std::abs(enu[2]) / enu.norm();
+    return std::sqrt(1. - costheta*costheta);
+}
+
+TEST(IncidenceAngleTableTest, MatchPerPixel) {
+
+    // Load the product
+    isce::io::IH5File file("../../data/envisat.h5");
+    isce::product::Product product(file);
+
+    const isce::product::RadarGridParameters radarGrid(product, 'A', 1, 1);
+    const isce::core::Orbit orbit = product.metadata().orbit();
+    const isce::core::Ellipsoid ellps(isce::core::EarthSemiMajorAxis,
+                                      isce::core::EarthEccentricitySquared);
+    const int lookSide = product.lookSide();
+    const double height = 500.0;
+
+    // Build table
+    isce::geometry::IncidenceAngleTable table(radarGrid, orbit, ellps, lookSide, height);
+    ASSERT_EQ(table.length(), radarGrid.length());
+    ASSERT_EQ(table.width(), radarGrid.width());
+
+    // Compare against per-pixel solves on a sparse set of lines
+    const isce::geometry::DEMInterpolator flatInterp(height);
+    std::valarray<double> sinInc(radarGrid.width());
+    double maxErr = 0.0;
+    for (size_t line = 0; line < radarGrid.length(); line += radarGrid.length() / 7) {
+        table.sinIncidenceLine(line, sinInc);
+        for (size_t rbin = 0; rbin < radarGrid.width(); rbin += 3) {
+            const double ref = sinIncidencePixel(radarGrid.sensingTime(line),
+                                                 radarGrid.slantRange(rbin),
+                                                 orbit, ellps, flatInterp,
+                                                 radarGrid.wavelength(), lookSide,
+                                                 height);
+            maxErr = std::max(maxErr, std::abs(sinInc[rbin] - ref));
+            ASSERT_NEAR(table.sinIncidence(line, rbin), sinInc[rbin], 1.0e-15);
+        }
+    }
+
+    printf("max sin(inc) error = %g\n", maxErr);
+    ASSERT_LT(maxErr, 1.0e-6);
+}
+
+int main(int argc, char * argv[]) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+// end of file
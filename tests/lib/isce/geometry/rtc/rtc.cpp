@@ -1,11 +1,45 @@
+#include <cmath>
+#include <fstream>
+#include <string>
+#include <valarray>
+#include <vector>
 #include <gtest/gtest.h>
 #include "isce/core/Constants.h"
+#include "isce/core/Ellipsoid.h"
 #include "isce/core/Serialization.h"
 #include "isce/io/IH5.h"
 #include "isce/io/Raster.h"
 #include "isce/product/Product.h"
 #include "isce/geometry/Serialization.h"
 #include "isce/geometry/RTC.h"
+#include "isce/geometry/Topo.h"
+#include "isce/geometry/geometry.h"
+
+// Subset of the envisat radar grid covered by the synthetic DEM
+const size_t synthLine0 = 200, synthBin0 = 200, synthSize = 64;
+
+// Geographic DEM around the radar grid subset with smooth sinusoidal relief
+void createSyntheticDEM(const std::string & filename) {
+
+    const size_t width = 120, length = 60;
+    const double lon0 = -115.610, lat0 = 34.845, spacing = 0.0005;
+    isce::io::Raster dem(filename, width, length, 1, GDT_Float32, "GTiff");
+    std::vector<double> geoTrans {lon0, spacing, 0.0, lat0, 0.0, -spacing};
+    dem.setGeoTransform(geoTrans);
+    dem.setEPSG(4326);
+
+    std::valarray<float> heights(width * length);
+    for (size_t i = 0; i < length; ++i) {
+        for (size_t j = 0; j < width; ++j) {
+            const double lon = lon0 + (j + 0.5) * spacing;
+            const double lat = lat0 - (i + 0.5) * spacing;
+            heights[i * width + j] = 300.0
+                + 60.0 * std::sin(2.0 * M_PI * (lon - lon0) / 0.01)
+                       * std::cos(2.0 * M_PI * (lat - lat0) / 0.008);
+        }
+    }
+    dem.setBlock(heights, 0, 0, width, length);
+}
 
 TEST(TestRTC, RunRTC) {
     // Open HDF5 file and load products
@@ -74,6 +108,44 @@ TEST(TestRTC, CheckResults) {
     ASSERT_TRUE(nneg < 1e-4 * refRaster.width() * refRaster.length());
 }
 
+// Sharing lattice corners between facets must not change the output. The
+// reference was computed by the per-facet facetRTC before corners were shared,
+// single-threaded, and is stored as raw little-endian float32. Differences can
+// only come from the order of the atomic accumulation.
+TEST(TestRTC, CheckStoredSyntheticReference) {
+
+    isce::io::IH5File file("../../data/envisat.h5");
+    isce::product::Product product(file);
+    const isce::product::RadarGridParameters fullGrid(product, 'A', 1, 1);
+    const isce::product::RadarGridParameters radarGrid(1, 1,
+        fullGrid.sensingStart() + synthLine0 / fullGrid.prf(), fullGrid.wavelength(),
+        fullGrid.prf(), fullGrid.slantRange(synthBin0), fullGrid.rangePixelSpacing(),
+        synthSize, synthSize, fullGrid.refEpoch());
+    isce::core::LUT2d<double> dop = product.metadata().procInfo().dopplerCentroid('A');
+    dop.boundsError(false);
+
+    createSyntheticDEM("./synthetic_dem.tif");
+    isce::io::Raster dem("./synthetic_dem.tif");
+    isce::io::Raster outRaster("./rtc_synthetic.bin", synthSize, synthSize, 1,
+                               GDT_Float32, "ENVI");
+    isce::geometry::facetRTC(radarGrid, product.metadata().orbit(), dop, dem,
+                             outRaster, product.lookSide());
+
+    std::valarray<float> test(synthSize * synthSize), ref(synthSize * synthSize);
+    outRaster.getBlock(test, 0, 0, synthSize, synthSize);
+    std::ifstream refFile("../../data/rtc/rtc_synthetic", std::ios::binary);
+    ASSERT_TRUE(refFile.good());
+    refFile.read(reinterpret_cast<char *>(&ref[0]), ref.size() * sizeof(float));
+    ASSERT_TRUE(refFile.good());
+
+    size_t nvalid = 0;
+    for (size_t i = 0; i < test.size(); ++i) {
+        ASSERT_NEAR(test[i], ref[i], 1.0e-6 * std::abs(ref[i])) << "pixel " << i;
+        nvalid += (ref[i] > 0);
+    }
+    ASSERT_GT(nvalid, test.size() / 2);
+}
+
 int main(int argc, char* argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -10,6 +10,8 @@
 #include <string>
 #include <sstream>
 #include <fstream>
+#include <limits>
+#include <sys/stat.h>
 #include <gtest/gtest.h>
 
 // isce::core
@@ -24,6 +26,7 @@
 #include "isce/product/Product.h"
 
 // isce::geometry
+#include "isce/geometry/DEMInterpolator.h"
 #include "isce/geometry/Serialization.h"
 #include "isce/geometry/Topo.h"
 
@@ -100,6 +103,131 @@ TEST(TopoTest, CheckResults) {
     }
 }
 
+TEST(TopoTest, SinglePrecisionXY) {
+
+    // Double precision x/y written by RunTopo
+    isce::io::Raster xRef("x.rdr");
+    isce::io::Raster yRef("y.rdr");
+    ASSERT_EQ(xRef.dtype(), GDT_Float64);
+    const size_t width = xRef.width();
+    const size_t length = xRef.length();
+    std::valarray<double> xd(width * length), yd(width * length);
+    xRef.getBlock(xd, 0, 0, width, length);
+    yRef.getBlock(yd, 0, 0, width, length);
+
+    // Re-run topo for single precision x/y only, in a separate directory
+    isce::io::IH5File file("../../data/envisat.h5");
+    isce::product::Product product(file);
+    isce::geometry::Topo topo(product, 'A', true);
+    std::ifstream xmlfid("../../data/topo.xml", std::ios::in);
+    {
+    cereal::XMLInputArchive archive(xmlfid);
+    archive(cereal::make_nvp("Topo", topo));
+    }
+    topo.outputLayers(isce::geometry::TOPO_X | isce::geometry::TOPO_Y);
+    topo.singlePrecisionXY(true);
+    mkdir("singleXY", 0755);
+    isce::io::Raster demRaster("../../data/srtm_cropped.tif");
+    topo.topo(demRaster, "singleXY");
+
+    // Float32 rasters holding the double precision values rounded to float
+    isce::io::Raster xTest("singleXY/x.rdr");
+    isce::io::Raster yTest("singleXY/y.rdr");
+    ASSERT_EQ(xTest.dtype(), GDT_Float32);
+    ASSERT_EQ(yTest.dtype(), GDT_Float32);
+    ASSERT_EQ(xTest.width(), width);
+    ASSERT_EQ(xTest.length(), length);
+    std::valarray<float> xs(width * length), ys(width * length);
+    xTest.getBlock(xs, 0, 0, width, length);
+    yTest.getBlock(ys, 0, 0, width, length);
+    const double eps = std::numeric_limits<float>::epsilon();
+    for (size_t i = 0; i < width * length; ++i) {
+        ASSERT_NEAR(xs[i], xd[i], eps * std::abs(xd[i]));
+        ASSERT_NEAR(ys[i], yd[i], eps * std::abs(yd[i]));
+    }
+}
+
+TEST(TopoTest, DEMGradient) {
+
+    // Open DEM raster
+    isce::io::Raster demRaster("../../data/srtm_cropped.tif");
+
+    // Bilinear interpolators with and without precomputed gradients
+    isce::geometry::DEMInterpolator demDiff(0.0, isce::core::BILINEAR_METHOD);
+    isce::geometry::DEMInterpolator demGrad(0.0, isce::core::BILINEAR_METHOD);
+    demGrad.computeGradients(true);
+    // Load an interior box of the DEM (EPSG:4326); bounds are in radians
+    double gt[6];
+    demRaster.getGeoTransform(gt);
+    const double radians = M_PI / 180.0;
+    const double minLon = (gt[0] + 0.25 * demRaster.width() * gt[1]) * radians;
+    const double maxLon = (gt[0] + 0.75 * demRaster.width() * gt[1]) * radians;
+    const double maxLat = (gt[3] + 0.25 * demRaster.length() * gt[5]) * radians;
+    const double minLat = (gt[3] + 0.75 * demRaster.length() * gt[5]) * radians;
+    demDiff.loadDEM(demRaster, minLon, maxLon, minLat, maxLat);
+    demGrad.loadDEM(demRaster, minLon, maxLon, minLat, maxLat);
+    ASSERT_FALSE(demDiff.haveGradients());
+    ASSERT_TRUE(demGrad.haveGradients());
+
+    // Other methods keep differencing interpolated heights
+    isce::geometry::DEMInterpolator demQuintic(0.0, isce::core::BIQUINTIC_METHOD);
+    demQuintic.computeGradients(true);
+    demQuintic.loadDEM(demRaster, minLon, maxLon, minLat, maxLat);
+    ASSERT_FALSE(demQuintic.haveGradients());
+
+    // For bilinear interpolation both must agree, including near the edges
+    // of the DEM subset
+    const size_t n = 40;
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+            const double col = (demGrad.width() + 2.0) * (i + 0.31) / n - 1.0;
+            const double row = (demGrad.length() + 2.0) * (j + 0.57) / n - 1.0;
+            const double x = demGrad.xStart() + col * demGrad.deltaX();
+            const double y = demGrad.yStart() + row * demGrad.deltaY();
+            double dx0, dy0, dx1, dy1;
+            const double h0 = demDiff.interpolateXY(x, y, dx0, dy0);
+            const double h1 = demGrad.interpolateXY(x, y, dx1, dy1);
+            ASSERT_EQ(h0, h1);
+            // Differencing sees heights interpolated in single precision
+            const double dh = 4.0 * std::numeric_limits<float>::epsilon()
+                            * (1.0 + std::abs(h0));
+            ASSERT_NEAR(dx0, dx1, dh / std::abs(demGrad.deltaX()));
+            ASSERT_NEAR(dy0, dy1, dh / std::abs(demGrad.deltaY()));
+        }
+    }
+}
+
+TEST(TopoTest, LayerSelection) {
+
+    using namespace isce::geometry;
+
+    // Only coordinates in single precision
+    TopoLayers layers;
+    layers.selection(TOPO_XYZ);
+    layers.singlePrecisionXY(true);
+    layers.setBlockSize(10, 20);
+    ASSERT_TRUE(layers.hasLayer(TOPO_X));
+    ASSERT_FALSE(layers.hasLayer(TOPO_MASK));
+    ASSERT_EQ(layers.x().size(), 0u);
+    ASSERT_EQ(layers.xSingle().size(), 200u);
+    ASSERT_EQ(layers.ySingle().size(), 200u);
+    ASSERT_EQ(layers.z().size(), 200u);
+    ASSERT_EQ(layers.inc().size(), 0u);
+    ASSERT_EQ(layers.localPsi().size(), 0u);
+    ASSERT_EQ(layers.crossTrack().size(), 0u);
+
+    // Values round-trip through single precision storage
+    layers.x(3, 7, -118.25);
+    ASSERT_EQ(layers.x(3, 7), -118.25);
+
+    // All layers by default
+    TopoLayers full(10, 20);
+    ASSERT_EQ(full.selection(), TOPO_ALL);
+    ASSERT_EQ(full.x().size(), 200u);
+    ASSERT_EQ(full.mask().size(), 200u);
+    ASSERT_EQ(full.crossTrack().size(), 200u);
+}
+
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -21,7 +21,8 @@ test: $(TESTS)
             } done
 
 # build
-PROJ_CLEAN += $(TESTS) warped.slc warped.slc.xml
+PROJ_CLEAN += $(TESTS) warped.slc warped.slc.xml \
+    warpedBand1.slc warpedBand1.slc.xml warpedBand2.slc warpedBand2.slc.xml
 PROJ_CXX_INCLUDES += $(EXPORT_ROOT)/include/$(PROJECT)-$(PROJECT_MAJOR).$(PROJECT_MINOR)
 PROJ_LIBRARIES = -lisce.$(PROJECT_MAJOR).$(PROJECT_MINOR) -lgtest
 LIBRARIES = $(PROJ_LIBRARIES) $(EXTERNAL_LIBS)
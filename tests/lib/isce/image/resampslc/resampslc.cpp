@@ -79,6 +79,47 @@ TEST(ResampSlcTest, Validate) {
     ASSERT_LT(abs_error, 1.0e-6);
 }
 
+// Multi-band resampling of the same band twice matches single-band resampling
+TEST(ResampSlcTest, ResampBands) {
+
+    // Open the HDF5 product
+    const std::string filename = "../../data/envisat.h5";
+    isce::io::IH5File file(filename);
+    isce::product::Product product(file);
+    isce::image::ResampSlc resamp(product);
+
+    // The HDF5 path to the input image
+    const std::string input_data = "HDF5:\"" + filename +
+        "\"://science/LSAR/SLC/swaths/frequencyA/HH";
+
+    // Single-band reference with the same tiling (does not rely on the output
+    // of the Resamp test)
+    resamp.linesPerTile(249);
+    resamp.resamp(input_data, "warpedBand0.slc",
+                  "../../data/offsets/range.off", "../../data/offsets/azimuth.off");
+
+    // Resample two bands with shared offsets
+    resamp.resampBands({input_data, input_data}, {"warpedBand1.slc", "warpedBand2.slc"},
+                       "../../data/offsets/range.off", "../../data/offsets/azimuth.off");
+
+    // Compare with single-band output
+    isce::io::Raster refSlc("warpedBand0.slc");
+    isce::io::Raster band1("warpedBand1.slc"), band2("warpedBand2.slc");
+    double maxError = 0.0;
+    for (size_t i = 0; i < refSlc.length(); ++i) {
+        for (size_t j = 0; j < refSlc.width(); ++j) {
+            std::complex<float> refValue, value1, value2;
+            refSlc.getValue(refValue, j, i);
+            band1.getValue(value1, j, i);
+            band2.getValue(value2, j, i);
+            ASSERT_EQ(value1, value2);
+            maxError = std::max(maxError,
+                (double) (std::abs(value1 - refValue) / (std::abs(refValue) + 1.0)));
+        }
+    }
+    ASSERT_LT(maxError, 1.0e-5);
+}
+
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
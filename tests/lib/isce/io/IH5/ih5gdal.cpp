@@ -8,6 +8,9 @@
 #include <cstdio>
 #include <cmath>
 #include <numeric>
+#include <array>
+#include <complex>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "isce/io/IH5Dataset.h"
@@ -81,6 +84,97 @@ TEST_F(IH5Test, dataSet3D) {
 }
 
 
+TEST_F(IH5Test, directWindowRead) {
+    isce::io::IH5File file(rFileName);
+    std::string datasetName("/science/LSAR/SLC/swaths/frequencyA/HH");
+
+    isce::io::IDataSet dset = file.openDataSet(datasetName);
+    auto dims = dset.getDimensions();
+    std::string fname = dset.toGDAL();
+
+    GDALDataset *ds = static_cast<GDALDataset*>(GDALOpen(fname.c_str(), GA_ReadOnly));
+    GDALRasterBand *band = ds->GetRasterBand(1);
+
+    //Read entire dataset through HDF5 for reference
+    std::vector<std::complex<float>> ref(dims[0] * dims[1]);
+    dset.read(ref);
+
+    //Full resolution window read
+    const int xoff = 7, yoff = 11;
+    const int width = 40, length = 30;
+    std::vector<std::complex<float>> win(width * length);
+    ASSERT_EQ(band->RasterIO(GF_Read, xoff, yoff, width, length, win.data(),
+                             width, length, GDT_CFloat32, 0, 0), CE_None);
+    for (int i = 0; i < length; ++i) {
+        for (int j = 0; j < width; ++j) {
+            ASSERT_EQ(win[i*width + j], ref[(yoff + i)*dims[1] + xoff + j]);
+        }
+    }
+
+    //Decimated window read with padded line spacing
+    const int xdec = 2, ydec = 3, pad = 5;
+    const int dwidth = width / xdec, dlength = length / ydec;
+    std::vector<std::complex<float>> dwin((dwidth + pad) * dlength);
+    ASSERT_EQ(band->RasterIO(GF_Read, xoff, yoff, width, length, dwin.data(),
+                             dwidth, dlength, GDT_CFloat32, 0,
+                             (dwidth + pad) * sizeof(std::complex<float>)), CE_None);
+    for (int i = 0; i < dlength; ++i) {
+        for (int j = 0; j < dwidth; ++j) {
+            const int row = yoff + i*ydec + ydec/2;
+            const int col = xoff + j*xdec + xdec/2;
+            ASSERT_EQ(dwin[i*(dwidth + pad) + j], ref[row*dims[1] + col]);
+        }
+    }
+
+    //Close datasets
+    GDALClose(ds);
+    dset.close();
+}
+
+TEST_F(IH5Test, directWindowWrite) {
+    const std::string wFileName("directWrite.h5");
+    const int nrows = 12, ncols = 16;
+    {
+        isce::io::IH5File file(wFileName, 'x');
+        isce::io::IGroup grp = file.openGroup("/");
+        std::vector<float> zeros(nrows * ncols, 0.0f);
+        std::array<int, 2> dims = {nrows, ncols};
+        isce::io::IDataSet dset = grp.createDataSet(std::string("data"), zeros, dims);
+        std::string fname = dset.toGDAL();
+
+        GDALDataset *ds = static_cast<GDALDataset*>(GDALOpen(fname.c_str(), GA_Update));
+        GDALRasterBand *band = ds->GetRasterBand(1);
+
+        //Full resolution window write goes straight to HDF5
+        const int width = 5, length = 4;
+        std::vector<float> win(width * length);
+        std::iota(win.begin(), win.end(), 1.0f);
+        ASSERT_EQ(band->RasterIO(GF_Write, 1, 2, width, length, win.data(),
+                                 width, length, GDT_Float32, 0, 0), CE_None);
+
+        //Smaller buffer is replicated over the window, not written strided
+        std::vector<float> small {-1.0f, -2.0f, -3.0f, -4.0f, -5.0f, -6.0f};
+        ASSERT_EQ(band->RasterIO(GF_Write, 8, 6, 6, 4, small.data(),
+                                 3, 2, GDT_Float32, 0, 0), CE_None);
+        GDALClose(ds);
+
+        std::vector<float> data(nrows * ncols);
+        dset.read(data);
+        for (int i = 0; i < length; ++i) {
+            for (int j = 0; j < width; ++j) {
+                ASSERT_EQ(data[(2 + i)*ncols + 1 + j], win[i*width + j]);
+            }
+        }
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 6; ++j) {
+                ASSERT_EQ(data[(6 + i)*ncols + 8 + j], small[(i/2)*3 + j/2]);
+            }
+        }
+        dset.close();
+    }
+    std::remove(wFileName.c_str());
+}
+
 // Main
 int main( int argc, char * argv[] ) {
     testing::InitGoogleTest( &argc, argv );
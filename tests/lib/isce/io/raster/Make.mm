@@ -23,7 +23,7 @@ test: $(TESTS)
             } done
 
 # build
-PROJ_CLEAN += $(TESTS) inc.bin inc.hdr lat.tif lon lon.vrt msk msk.bin topo.vrt test test.vrt
+PROJ_CLEAN += $(TESTS) inc.bin inc.hdr lat.tif lon lon.vrt msk msk.bin multiband.bin multiband.hdr topo.vrt test test.vrt
 PROJ_CXX_INCLUDES += $(EXPORT_ROOT)/include/$(PROJECT)-$(PROJECT_MAJOR).$(PROJECT_MINOR)
 PROJ_LIBRARIES = -lisce.$(PROJECT_MAJOR).$(PROJECT_MINOR) -lgtest
 LIBRARIES = $(PROJ_LIBRARIES) $(EXTERNAL_LIBS)
@@ -35,6 +35,7 @@ struct RasterTest : public ::testing::Test {
   const std::string incFilename = "inc.bin";
   const std::string mskFilename = "msk.bin";
   const std::string vrtFilename = "topo.vrt";
+  const std::string mbFilename  = "multiband.bin";
 };
 
 
@@ -162,6 +163,15 @@ TEST_F(RasterTest, setGetBlockBandTwoENVIRaster) {
 }
 
 
+// Failed block transfers are reported as exceptions
+TEST_F(RasterTest, getBlockOutOfBoundsThrows) {
+  isce::io::Raster inc = isce::io::Raster(incFilename);
+  std::valarray<int> block( nbx*nby );
+  ASSERT_THROW( inc.getBlock( block, nc-1, nl-1, nbx, nby, 1 ),
+                isce::except::RuntimeError );   // block extends past the raster
+}
+
+
 
 // Create VRT multiband from std::vector of Raster objects
 TEST_F(RasterTest, createMultiBandVRT) {
@@ -257,6 +267,50 @@ TEST_F(RasterTest, addRasterToVRT) {
 
 
 
+// Write and read several bands at once with band sequential and interleaved buffers
+TEST_F(RasterTest, setGetMultiBandBlockLayouts) {
+  std::remove(mbFilename.c_str());
+  isce::io::Raster mb = isce::io::Raster(mbFilename, nc, nl, 3, GDT_Float32, "ENVI");
+  const std::vector<int> bands {1, 2, 3};
+  const size_t npix = nbx*nby;
+
+  // write bands 1-3 of a block from a band sequential buffer
+  std::valarray<float> bsq(3*npix);
+  for (size_t i=0; i<bsq.size(); ++i)
+    bsq[i] = i;
+  mb.setBlock( bsq, nbx, nby, nbx, nby, bands );
+
+  // single-band reads must match the band sequential buffer
+  std::valarray<float> block(npix);
+  for (int b : bands) {
+    mb.getBlock( block, nbx, nby, nbx, nby, b );
+    for (size_t i=0; i<npix; ++i)
+      ASSERT_EQ( block[i], bsq[(b-1)*npix + i] );
+  }
+
+  // pixel and line interleaved reads of bands 3 and 1
+  std::valarray<float> bip(2*npix), bil(2*npix);
+  mb.getBlock( bip, nbx, nby, nbx, nby, {3, 1}, isce::io::BIP_LAYOUT );
+  mb.getBlock( bil, nbx, nby, nbx, nby, {3, 1}, isce::io::BIL_LAYOUT );
+  for (size_t l=0; l<nby; ++l) {
+    for (size_t c=0; c<nbx; ++c) {
+      const size_t i = l*nbx + c;
+      ASSERT_EQ( bip[2*i],               bsq[2*npix + i] );
+      ASSERT_EQ( bip[2*i + 1],           bsq[i] );
+      ASSERT_EQ( bil[2*l*nbx + c],       bsq[2*npix + i] );
+      ASSERT_EQ( bil[(2*l + 1)*nbx + c], bsq[i] );
+    }
+  }
+
+  // buffer too small for the requested bands
+  ASSERT_THROW( mb.getBlock( block, nbx, nby, nbx, nby, bands ), isce::except::LengthError );
+
+  // block extends past the raster
+  std::valarray<float> edge(3*npix);
+  ASSERT_THROW( mb.getBlock( edge, nc-1, nl-1, nbx, nby, bands ), isce::except::RuntimeError );
+}
+
+
 // Main
 int main( int argc, char * argv[] ) {
     testing::InitGoogleTest( &argc, argv );
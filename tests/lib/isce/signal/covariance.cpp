@@ -12,6 +12,9 @@
 #include <cmath>
 #include <complex>
 #include <map>
+#include <string>
+#include <vector>
+#include <functional>
 #include <gtest/gtest.h>
 #include <isce/io/Raster.h>
 #include <isce/signal/Covariance.h>
@@ -21,6 +24,17 @@
 // To create test data
 void createTestData();
 
+// Reciprocal scattering matrix of pixel i of the quad-pol test data
+std::complex<float> simulatedHH(size_t i) { return std::complex<float>(1.0 + 0.002*i, 0.5); }
+std::complex<float> simulatedHV(size_t i) { return std::complex<float>(0.2, -0.1 + 0.001*i); }
+std::complex<float> simulatedVV(size_t i) { return std::complex<float>(-0.7, 0.3 - 0.002*i); }
+
+// Quad-pol rasters of the simulated scattering matrix rotated as
+// [a b; -b a] S [a b; -b a], with a = cos(omega) and b = sin(omega)
+void createFaradayTestData(const std::string & prefix, size_t width, size_t length,
+                           std::function<double(size_t, size_t)> omega,
+                           std::map<std::string, isce::io::Raster> & slcList);
+
 TEST(Covariance, DualpolRun)
 {
 
@@ -124,6 +138,261 @@ TEST(Covariance, DualpolCheck)
 
 }
 
+TEST(Covariance, QuadpolFaradayRun)
+{
+    size_t width = 20;
+    size_t length = 20;
+    // Faraday rotation applied to the test data
+    double omega = 0.2;
+
+    // make rasters for four SLC polarizations; the scattering matrix is
+    // reciprocal before the Faraday rotation is applied
+    std::map<std::string, isce::io::Raster> slcList;
+    std::map<std::string, isce::io::Raster> correctedSlcList;
+    std::map<std::string, std::valarray<std::complex<float>>> data;
+    for (const std::string pol : {"hh", "hv", "vh", "vv"}) {
+        slcList.emplace(pol, isce::io::Raster("faraday_" + pol + ".vrt",
+                                width, length, 1, GDT_CFloat32, "VRT"));
+        correctedSlcList.emplace(pol, isce::io::Raster("corrected_" + pol + ".vrt",
+                                width, length, 1, GDT_CFloat32, "VRT"));
+        data[pol].resize(width*length);
+    }
+
+    float a = std::cos(omega);
+    float b = std::sin(omega);
+    for (size_t i = 0; i < length*width; ++i) {
+        std::complex<float> hh(1.0 + 0.01*i, 0.5);
+        std::complex<float> hv(0.2, -0.1 + 0.002*i);
+        std::complex<float> vv(-0.7, 0.3 - 0.005*i);
+        // [a b; -b a] S [a b; -b a]
+        data["hh"][i] = a*a*hh - b*b*vv;
+        data["hv"][i] = a*b*hh + (a*a + b*b)*hv + a*b*vv;
+        data["vh"][i] = -a*b*hh + (a*a + b*b)*hv - a*b*vv;
+        data["vv"][i] = a*a*vv - b*b*hh;
+    }
+    for (auto & item : slcList) {
+        item.second.setBlock(data[item.first], 0, 0, width, length);
+    }
+
+    std::map<std::pair<std::string, std::string>, isce::io::Raster> covList;
+    for (const auto & term : std::vector<std::pair<std::string, std::string>> {
+            {"hh", "hh"}, {"hh", "vh"}, {"hh", "hv"}, {"hh", "vv"},
+            {"vh", "vh"}, {"vh", "hv"}, {"vh", "vv"},
+            {"hv", "hv"}, {"hv", "vv"}, {"vv", "vv"}}) {
+        covList.emplace(term, isce::io::Raster(
+            "faraday_cov_" + term.first + "_" + term.second + ".vrt",
+            width, length, 1, GDT_CFloat32, "VRT"));
+    }
+
+    isce::io::Raster faradayAngleRaster("faraday_angle.vrt", width/5, length/5, 1,
+                                        GDT_Float32, "VRT");
+
+    isce::signal::Covariance<std::complex<float>> covarianceObj;
+    covarianceObj.numberOfRangeLooks(1);
+    covarianceObj.numberOfAzimuthLooks(1);
+    covarianceObj.linesPerBlock(8);
+    covarianceObj.covariance(slcList, covList, faradayAngleRaster, 5, 5,
+                             &correctedSlcList);
+}
+
+TEST(Covariance, QuadpolFaradayCheck)
+{
+    size_t width = 20;
+    size_t length = 20;
+    double tol = 1e-4;
+
+    // estimated Faraday rotation removes the simulated one
+    isce::io::Raster faradayAngleRaster("faraday_angle.vrt");
+    std::valarray<float> faradayAngle(faradayAngleRaster.width()*faradayAngleRaster.length());
+    faradayAngleRaster.getBlock(faradayAngle, 0, 0, faradayAngleRaster.width(),
+                                faradayAngleRaster.length());
+    for (size_t i = 0; i < faradayAngle.size(); ++i) {
+        ASSERT_NEAR(faradayAngle[i], -0.2, tol);
+    }
+
+    // corrected SLCs are reciprocal and match the simulated scattering matrix
+    std::map<std::string, std::valarray<std::complex<float>>> data;
+    for (const std::string pol : {"hh", "hv", "vh", "vv"}) {
+        isce::io::Raster raster("corrected_" + pol + ".vrt");
+        data[pol].resize(width*length);
+        raster.getBlock(data[pol], 0, 0, width, length);
+    }
+    for (size_t i = 0; i < length*width; ++i) {
+        ASSERT_NEAR(std::abs(data["hh"][i] - std::complex<float>(1.0 + 0.01*i, 0.5)), 0, tol);
+        ASSERT_NEAR(std::abs(data["hv"][i] - std::complex<float>(0.2, -0.1 + 0.002*i)), 0, tol);
+        ASSERT_NEAR(std::abs(data["vh"][i] - data["hv"][i]), 0, tol);
+        ASSERT_NEAR(std::abs(data["vv"][i] - std::complex<float>(-0.7, 0.3 - 0.005*i)), 0, tol);
+    }
+
+    // covariance is formed from the corrected SLCs
+    isce::io::Raster c_hh_vv_raster("faraday_cov_hh_vv.vrt");
+    std::valarray<std::complex<float>> c_hh_vv(length*width);
+    c_hh_vv_raster.getBlock(c_hh_vv, 0, 0, width, length);
+    for (size_t i = 0; i < length*width; ++i) {
+        ASSERT_NEAR(std::abs(c_hh_vv[i] - data["hh"][i]*std::conj(data["vv"][i])), 0, tol);
+    }
+}
+
+TEST(Covariance, FaradayRotationPair)
+{
+    size_t width = 30;
+    size_t length = 24;
+    size_t rngLooks = 5;
+    size_t azLooks = 4;
+    size_t widthLooked = width/rngLooks;
+    size_t lengthLooked = length/azLooks;
+    double tol = 1e-4;
+
+    // Faraday rotation constant within each multi-looked cell
+    auto omega = [=](size_t line, size_t col) {
+        return 0.1 + 0.03*(line/azLooks) - 0.02*(col/rngLooks);
+    };
+
+    std::map<std::string, isce::io::Raster> slcList;
+    std::map<std::string, isce::io::Raster> correctedSlcList;
+    createFaradayTestData("pair_", width, length, omega, slcList);
+    for (const std::string pol : {"hh", "hv", "vh", "vv"}) {
+        correctedSlcList.emplace(pol, isce::io::Raster("pair_corrected_" + pol + ".vrt",
+                                width, length, 1, GDT_CFloat32, "VRT"));
+    }
+
+    // estimate the Faraday rotation of every cell
+    isce::io::Raster faradayAngleRaster("pair_angle.vrt", widthLooked, lengthLooked, 1,
+                                        GDT_Float32, "VRT");
+    isce::signal::Covariance<std::complex<float>> covarianceObj;
+    covarianceObj.linesPerBlock(8);
+    covarianceObj.faradayRotation(slcList, faradayAngleRaster, rngLooks, azLooks);
+
+    std::valarray<float> faradayAngle(widthLooked*lengthLooked);
+    faradayAngleRaster.getBlock(faradayAngle, 0, 0, widthLooked, lengthLooked);
+    isce::core::Matrix<double> angle(lengthLooked, widthLooked);
+    for (size_t line = 0; line < lengthLooked; ++line) {
+        for (size_t col = 0; col < widthLooked; ++col) {
+            angle(line, col) = faradayAngle[line*widthLooked + col];
+            ASSERT_NEAR(angle(line, col), -omega(line*azLooks, col*rngLooks), tol);
+        }
+    }
+
+    // remove it with the angle of the cell holding each pixel
+    isce::core::LUT2d<double> faradayLUT(0.5*(rngLooks - 1), 0.5*(azLooks - 1),
+                                         rngLooks, azLooks, angle,
+                                         isce::core::NEAREST_METHOD, false);
+    covarianceObj.correctFaradayRotation(slcList, faradayLUT, correctedSlcList);
+
+    std::map<std::string, std::valarray<std::complex<float>>> data;
+    for (auto & item : correctedSlcList) {
+        data[item.first].resize(width*length);
+        item.second.getBlock(data[item.first], 0, 0, width, length);
+    }
+    for (size_t i = 0; i < length*width; ++i) {
+        ASSERT_NEAR(std::abs(data["hh"][i] - simulatedHH(i)), 0, tol);
+        ASSERT_NEAR(std::abs(data["hv"][i] - simulatedHV(i)), 0, tol);
+        ASSERT_NEAR(std::abs(data["vh"][i] - simulatedHV(i)), 0, tol);
+        ASSERT_NEAR(std::abs(data["vv"][i] - simulatedVV(i)), 0, tol);
+    }
+}
+
+TEST(Covariance, QuadpolFaradayLooks)
+{
+    size_t width = 30;
+    size_t length = 26;
+    size_t rngLooks = 2;
+    size_t azLooks = 3;
+    size_t faradayRngLooks = 5;
+    size_t faradayAzLooks = 4;
+    size_t widthLooked = width/rngLooks;
+    size_t lengthLooked = length/azLooks;
+    double tol = 1e-4;
+
+    // neither the covariance nor the Faraday azimuth looks divide the lines
+    // per block, so blocks are rounded to lcm(3, 4) = 12 lines
+    std::map<std::string, isce::io::Raster> slcList;
+    createFaradayTestData("looks_", width, length,
+                          [](size_t, size_t) { return 0.2; }, slcList);
+
+    std::map<std::pair<std::string, std::string>, isce::io::Raster> covList;
+    for (const auto & term : std::vector<std::pair<std::string, std::string>> {
+            {"hh", "hh"}, {"hh", "vh"}, {"hh", "hv"}, {"hh", "vv"},
+            {"vh", "vh"}, {"vh", "hv"}, {"vh", "vv"},
+            {"hv", "hv"}, {"hv", "vv"}, {"vv", "vv"}}) {
+        covList.emplace(term, isce::io::Raster(
+            "looks_cov_" + term.first + "_" + term.second + ".vrt",
+            widthLooked, lengthLooked, 1, GDT_CFloat32, "VRT"));
+    }
+    isce::io::Raster faradayAngleRaster("looks_angle.vrt", width/faradayRngLooks,
+                                        length/faradayAzLooks, 1, GDT_Float32, "VRT");
+
+    isce::signal::Covariance<std::complex<float>> covarianceObj;
+    covarianceObj.numberOfRangeLooks(rngLooks);
+    covarianceObj.numberOfAzimuthLooks(azLooks);
+    covarianceObj.linesPerBlock(10);
+    covarianceObj.covariance(slcList, covList, faradayAngleRaster,
+                             faradayRngLooks, faradayAzLooks);
+
+    // every Faraday cell is estimated from whole looks
+    std::valarray<float> faradayAngle(faradayAngleRaster.width()*faradayAngleRaster.length());
+    faradayAngleRaster.getBlock(faradayAngle, 0, 0, faradayAngleRaster.width(),
+                                faradayAngleRaster.length());
+    for (size_t i = 0; i < faradayAngle.size(); ++i) {
+        ASSERT_NEAR(faradayAngle[i], -0.2, tol);
+    }
+
+    // every covariance cell sums the products of the corrected channels over
+    // its looks (Looks::multilook does not normalize complex data)
+    std::valarray<std::complex<float>> c_hh_vv(widthLooked*lengthLooked);
+    std::valarray<std::complex<float>> c_hv_hv(widthLooked*lengthLooked);
+    covList[std::make_pair("hh", "vv")].getBlock(c_hh_vv, 0, 0, widthLooked, lengthLooked);
+    covList[std::make_pair("hv", "hv")].getBlock(c_hv_hv, 0, 0, widthLooked, lengthLooked);
+    for (size_t line = 0; line < lengthLooked; ++line) {
+        for (size_t col = 0; col < widthLooked; ++col) {
+            std::complex<float> expected_hh_vv(0.0, 0.0), expected_hv_hv(0.0, 0.0);
+            for (size_t ii = 0; ii < azLooks; ++ii) {
+                for (size_t jj = 0; jj < rngLooks; ++jj) {
+                    size_t i = (line*azLooks + ii)*width + col*rngLooks + jj;
+                    expected_hh_vv += simulatedHH(i)*std::conj(simulatedVV(i));
+                    expected_hv_hv += simulatedHV(i)*std::conj(simulatedHV(i));
+                }
+            }
+            ASSERT_NEAR(std::abs(c_hh_vv[line*widthLooked + col] - expected_hh_vv), 0, tol);
+            ASSERT_NEAR(std::abs(c_hv_hv[line*widthLooked + col] - expected_hv_hv), 0, tol);
+        }
+    }
+}
+
+TEST(Covariance, QuadpolFaradayZeroLooks)
+{
+    size_t width = 10;
+    size_t length = 8;
+
+    std::map<std::string, isce::io::Raster> slcList;
+    createFaradayTestData("zero_looks_", width, length,
+                          [](size_t, size_t) { return 0.2; }, slcList);
+
+    std::map<std::pair<std::string, std::string>, isce::io::Raster> covList;
+    for (const auto & term : std::vector<std::pair<std::string, std::string>> {
+            {"hh", "hh"}, {"hh", "vh"}, {"hh", "hv"}, {"hh", "vv"},
+            {"vh", "vh"}, {"vh", "hv"}, {"vh", "vv"},
+            {"hv", "hv"}, {"hv", "vv"}, {"vv", "vv"}}) {
+        covList.emplace(term, isce::io::Raster(
+            "zero_looks_cov_" + term.first + "_" + term.second + ".vrt",
+            width, length, 1, GDT_CFloat32, "VRT"));
+    }
+    isce::io::Raster faradayAngleRaster("zero_looks_angle.vrt", width, length, 1,
+                                        GDT_Float32, "VRT");
+
+    // zero Faraday looks in either direction
+    isce::signal::Covariance<std::complex<float>> covarianceObj;
+    EXPECT_THROW(covarianceObj.covariance(slcList, covList, faradayAngleRaster, 0, 1),
+                 isce::except::InvalidArgument);
+    EXPECT_THROW(covarianceObj.covariance(slcList, covList, faradayAngleRaster, 1, 0),
+                 isce::except::InvalidArgument);
+
+    // zero covariance looks
+    covarianceObj.numberOfAzimuthLooks(0);
+    EXPECT_THROW(covarianceObj.covariance(slcList, covList, faradayAngleRaster, 1, 1),
+                 isce::except::InvalidArgument);
+}
+
 int main(int argc, char * argv[]) {
       testing::InitGoogleTest(&argc, argv);
       return RUN_ALL_TESTS();
@@ -154,3 +423,30 @@ void createTestData() {
     slcHV.setBlock(shv, 0, 0, width, length);
 
 }
+
+void createFaradayTestData(const std::string & prefix, size_t width, size_t length,
+                           std::function<double(size_t, size_t)> omega,
+                           std::map<std::string, isce::io::Raster> & slcList) {
+
+    std::map<std::string, std::valarray<std::complex<float>>> data;
+    for (const std::string pol : {"hh", "hv", "vh", "vv"}) {
+        slcList.emplace(pol, isce::io::Raster(prefix + pol + ".vrt",
+                                width, length, 1, GDT_CFloat32, "VRT"));
+        data[pol].resize(width*length);
+    }
+
+    for (size_t i = 0; i < length*width; ++i) {
+        float a = std::cos(omega(i/width, i%width));
+        float b = std::sin(omega(i/width, i%width));
+        std::complex<float> hh = simulatedHH(i);
+        std::complex<float> hv = simulatedHV(i);
+        std::complex<float> vv = simulatedVV(i);
+        data["hh"][i] = a*a*hh - b*b*vv;
+        data["hv"][i] = a*b*hh + (a*a + b*b)*hv + a*b*vv;
+        data["vh"][i] = -a*b*hh + (a*a + b*b)*hv - a*b*vv;
+        data["vv"][i] = a*a*vv - b*b*hh;
+    }
+    for (auto & item : slcList) {
+        item.second.setBlock(data[item.first], 0, 0, width, length);
+    }
+}
@@ -61,6 +61,63 @@ TEST(Filter, constructAzimuthCommonbandFilter)
 
 }
 
+TEST(Filter, azimuthCommonbandFilterMatchesPerPixel)
+{
+    //This test checks the compact azimuth common band filter against a
+    //filter built pixel by pixel, for Dopplers that vary across range.
+    const size_t ncols = 64;
+    const size_t blockRows = 128;
+    const double prf = 1700.0;
+    const double bandwidth = 1000.0;
+    const double beta = 0.25;
+
+    // synthetic Doppler LUTs over range bins
+    std::valarray<double> bins(ncols), refValues(ncols), secValues(ncols);
+    for (size_t j = 0; j < ncols; ++j) {
+        bins[j] = j;
+        refValues[j] = 300.0 + 4.0 * j - 0.02 * j * j;
+        secValues[j] = -200.0 + 2.0 * j;
+    }
+    isce::core::LUT1d<double> refDoppler(bins, refValues);
+    isce::core::LUT1d<double> secDoppler(bins, secValues);
+
+    std::valarray<std::complex<double>> slc(ncols*blockRows);
+    std::valarray<std::complex<double>> spectrum(ncols*blockRows);
+    isce::signal::Filter<double> filter;
+    filter.constructAzimuthCommonbandFilter(refDoppler, secDoppler, bandwidth,
+                                            prf, beta, slc, spectrum,
+                                            ncols, blockRows);
+
+    // materialize the compact filter
+    std::valarray<std::complex<double>> compact(std::complex<double>(1.0, 0.0),
+                                                ncols*blockRows);
+    filter.applyFilter(compact);
+
+    // per-pixel raised cosine filter, normalized by (N + iN)
+    std::valarray<double> frequency(blockRows);
+    isce::signal::fftfreq(1.0/prf, frequency);
+    const double df = 0.5 * bandwidth * beta;
+    const std::complex<double> norm(blockRows, blockRows);
+    size_t ntransition = 0;
+    for (size_t i = 0; i < blockRows; ++i) {
+        for (size_t j = 0; j < ncols; ++j) {
+            const double fmid = 0.5 * (refDoppler.eval(j) + secDoppler.eval(j));
+            const double freq = std::abs(frequency[i] - fmid);
+            double h = 0.0;
+            if (freq <= (0.5 * bandwidth - df)) {
+                h = 1.0;
+            } else if (freq <= (0.5 * bandwidth + df)) {
+                h = 0.5 * (1.0 + std::cos(M_PI / (bandwidth*beta) *
+                                          (freq - 0.5 * (1.0 - beta) * bandwidth)));
+                ++ntransition;
+            }
+            const std::complex<double> ref = std::complex<double>(h, 0.0) / norm;
+            ASSERT_NEAR(std::abs(compact[i*ncols + j] - ref), 0.0, 1.0e-14);
+        }
+    }
+    ASSERT_GT(ntransition, ncols);
+}
+
 TEST(Filter, constructBoxcarRangeBandpassFilter)
 {
     //This test constructs a boxcar range band-pass filter.
@@ -118,6 +175,50 @@ TEST(Filter, constructBoxcarRangeBandpassFilter)
     
 }
 
+TEST(Filter, applyRangeBandpassFilter)
+{
+    //This test checks that a range filter stored per frequency bin
+    //removes an out-of-band tone on every line of a block.
+    const size_t ncols = 64;
+    const size_t blockRows = 8;
+    const double rangeSamplingFrequency = 1.0;
+
+    std::valarray<std::complex<double>> slc(ncols*blockRows);
+    std::valarray<std::complex<double>> spectrum(ncols*blockRows);
+    std::valarray<std::complex<double>> inBand(ncols*blockRows);
+
+    // a tone inside the band (bin 2) and one outside (bin 24) with a line dependent phase
+    for (size_t line = 0; line < blockRows; ++line) {
+        for (size_t col = 0; col < ncols; ++col) {
+            const double phase0 = 0.3 * line;
+            const std::complex<double> s1 = std::polar(1.0, 2.0*M_PI*2*col/ncols + phase0);
+            const std::complex<double> s2 = std::polar(0.5, 2.0*M_PI*24*col/ncols - phase0);
+            slc[line*ncols + col] = s1 + s2;
+            inBand[line*ncols + col] = s1;
+        }
+    }
+
+    std::valarray<double> subBandCenterFrequencies{0.0};
+    std::valarray<double> subBandBandwidths{0.5};
+
+    isce::signal::Filter<double> filter;
+    filter.constructRangeBandpassFilter(rangeSamplingFrequency,
+                                subBandCenterFrequencies,
+                                subBandBandwidths,
+                                slc,
+                                spectrum,
+                                ncols,
+                                blockRows,
+                                "boxcar");
+    filter.filter(slc, spectrum);
+
+    // filter is normalized by (N + iN) and the FFTs are unnormalized
+    const std::complex<double> gain = 1.0 / std::complex<double>(1.0, 1.0);
+    for (size_t k = 0; k < ncols*blockRows; ++k) {
+        ASSERT_NEAR(std::abs(slc[k] - gain * inBand[k]), 0.0, 1.0e-10);
+    }
+}
+
 int main(int argc, char * argv[]) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
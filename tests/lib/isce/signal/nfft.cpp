@@ -145,6 +145,56 @@ TEST(AdjointNFFT, MedEven)   { test_adjoint_nfft(2, 256, 1024); }
 TEST(AdjointNFFT, LongEven)  { test_adjoint_nfft(4, 256, 1024); }
 TEST(AdjointNFFT, LongOdd)   { test_adjoint_nfft(4, 256,  625); }
 
+// Batched transforms should match line-by-line transforms.
+void
+test_many(size_t m, size_t nf, size_t fft_size, size_t howmany)
+{
+    const size_t nt = 100;
+    std::valarray<std::complex<double>> xf(howmany * nf), xt(howmany * nt),
+                                        xt_ref(nt), xf_adj(howmany * nf),
+                                        xf_ref(nf);
+    std::valarray<double> times(howmany * nt);
+
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(0.0, nf-1.0);
+    for (size_t i=0; i<times.size(); ++i) {
+        times[i] = uniform(rng);
+    }
+    for (size_t i=0; i<xf.size(); ++i) {
+        xf[i] = normal(rng) + 1i * normal(rng);
+    }
+
+    isce::signal::NFFT<double> nfft(m, nf, fft_size), ref(m, nf, fft_size);
+    nfft.execute_many(howmany, nf, 1, nf, &xf[0],
+                      nt, 1, nt, &times[0],
+                      nt, 1, nt, &xt[0]);
+    for (size_t line=0; line<howmany; ++line) {
+        ref.execute(nf, 1, &xf[line*nf], nt, 1, &times[line*nt],
+                    nt, 1, &xt_ref[0]);
+        for (size_t i=0; i<nt; ++i) {
+            EXPECT_NEAR(std::abs(xt[line*nt+i] - xt_ref[i]), 0.0, 1e-12);
+        }
+    }
+
+    // Adjoint with the time samples shared by all lines.
+    nfft.execute_adjoint_many(howmany, nt, 1, nt, &xt[0],
+                              nt, 1, 0, &times[0],
+                              nf, 1, nf, &xf_adj[0]);
+    for (size_t line=0; line<howmany; ++line) {
+        ref.execute_adjoint(nt, 1, &xt[line*nt], nt, 1, &times[0],
+                            nf, 1, &xf_ref[0]);
+        for (size_t i=0; i<nf; ++i) {
+            EXPECT_NEAR(std::abs(xf_adj[line*nf+i] - xf_ref[i]), 0.0, 1e-9);
+        }
+    }
+}
+
+TEST(NFFT, Many) { test_many(4, 256, 1024, 7); }
+TEST(NFFT, ManyOdd) { test_many(2, 64, 125, 3); }
+// More lines than one batch chunk, with a short final chunk.
+TEST(NFFT, ManyChunks) { test_many(2, 64, 128, 150); }
+
 TEST(Kernel, Singularity)
 {
     size_t m = 1;
@@ -81,6 +81,53 @@ TEST(shiftSignal, shiftSignal)
 
 }
 
+TEST(shiftSignal, shiftSignalInPlace2D)
+{
+    size_t width = 64;
+    size_t length = 32;
+
+    // instantiate a signal object
+    isce::signal::Signal<double> sigObj;
+
+    std::valarray<std::complex<double>> slc(width*length);
+    std::valarray<std::complex<double>> spec(width*length);
+
+    // setup the 2D FFT plans
+    sigObj.forward2DFFT(slc, spec, width, length);
+    sigObj.inverse2DFFT(spec, slc, width, length);
+
+    // a periodic band limited signal (a 2D linear phase ramp)
+    const double fx = 3.0 / width;
+    const double fy = 2.0 / length;
+    for (size_t line = 0; line < length; ++line) {
+        for (size_t col = 0; col < width; ++col) {
+            double phase = 2*M_PI*(fx*col + fy*line);
+            slc[line*width + col] = std::complex<double> (std::cos(phase), std::sin(phase));
+        }
+    }
+
+    // desired shifts in X and Y directions
+    double shiftX = 0.5;
+    double shiftY = -0.25;
+
+    // shift the signal in place
+    isce::signal::shiftSignal(slc, spec, width, length,
+                  shiftX, shiftY, sigObj);
+
+    double max_err = 0.0;
+    for (size_t line = 0; line < length; ++line) {
+        for (size_t col = 0; col < width; ++col) {
+            double phaseShifted = 2*M_PI*(fx*(col - shiftX) + fy*(line - shiftY));
+            std::complex<double> expectedSignal = std::complex<double>
+                            (std::cos(phaseShifted), std::sin(phaseShifted));
+            max_err = std::max(max_err, std::abs(slc[line*width + col] - expectedSignal));
+        }
+    }
+
+    std::cout << "max_err : " << max_err << std::endl;
+    ASSERT_LT(max_err, 1.0e-10);
+}
+
 int main(int argc, char * argv[]) {
       testing::InitGoogleTest(&argc, argv);
       return RUN_ALL_TESTS();
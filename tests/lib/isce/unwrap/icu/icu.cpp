@@ -5,6 +5,7 @@
 #include <valarray> // std::valarray, std::abs
 
 #include "isce/unwrap/icu/ICU.h" // isce::unwrap::icu::ICU
+#include "isce/unwrap/icu/PhaseGrad.h" // isce::unwrap::icu::calcPhaseGrad
 #include "isce/io/Raster.h" // isce::io::Raster
 
 TEST(ICU, GetSetters)
@@ -102,6 +103,67 @@ TEST(ICU, PhaseGradNeutronCalculation)
     ASSERT_TRUE((neut == refneut).min());
 }
 
+TEST(ICU, PhaseGradSeparableKernel)
+{
+    // Tall enough for several blocks of lines per thread
+    constexpr size_t l = 150;
+    constexpr size_t w = 50;
+    std::valarray<std::complex<float>> intf(l*w);
+
+    // Interferogram with spatially varying phase slope
+    for (size_t j = 0; j < l; ++j)
+    {
+        for (size_t i = 0; i < w; ++i)
+        {
+            float phi = 0.002f * float(i*i) + 0.05f * float(i*j) - 0.3f * float(j);
+            float mag = 1.f + 0.5f * float((i * 7 + j * 3) % 5);
+            intf[j * w + i] = std::polar(mag, phi);
+        }
+    }
+
+    for (int winsize : {3, 5, 9, 13})
+    {
+        std::valarray<float> gradx(l*w), grady(l*w);
+        isce::unwrap::icu::calcPhaseGrad(&gradx[0], &grady[0], &intf[0], l, w, winsize);
+
+        // Direct 2D weighted sum with the isotropic Gaussian kernel
+        const int h = winsize/2;
+        std::valarray<double> weights(winsize * winsize);
+        for (int jj = 0; jj < winsize; ++jj)
+        {
+            for (int ii = 0; ii < winsize; ++ii)
+            {
+                double x = ii - h;
+                double y = jj - h;
+                weights[jj * winsize + ii] = exp(-(x*x + y*y) / (winsize/2.));
+            }
+        }
+        weights /= weights.sum();
+
+        for (size_t j = h + 1; j < l - h; ++j)
+        {
+            for (size_t i = h + 1; i < w - h; ++i)
+            {
+                std::complex<double> sx = 0., sy = 0.;
+                for (int jj = -h; jj <= h; ++jj)
+                {
+                    for (int ii = -h; ii <= h; ++ii)
+                    {
+                        double wt = weights[(jj + h) * winsize + (ii + h)];
+                        std::complex<double> z_11 = intf[(j+jj) * w + (i+ii)];
+                        std::complex<double> z_10 = intf[(j+jj) * w + (i+ii-1)];
+                        std::complex<double> z_01 = intf[(j+jj-1) * w + (i+ii)];
+                        sx += wt * z_11 * std::conj(z_10);
+                        sy += wt * z_11 * std::conj(z_01);
+                    }
+                }
+                ASSERT_NEAR(gradx[j * w + i], std::arg(sx), 1.e-4);
+                ASSERT_NEAR(grady[j * w + i], std::arg(sy), 1.e-4);
+            }
+        }
+    }
+}
+
 TEST(ICU, IntensityNeutronCalculation)
 {
     isce::unwrap::icu::ICU icuobj;
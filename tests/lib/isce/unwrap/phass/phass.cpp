@@ -1,10 +1,13 @@
 #include <cmath> // cos, sin, sqrt, fmod
 #include <complex> // std::complex, std::arg
 #include <cstdint> // uint8_t
+#include <queue> // std::queue
+#include <vector> // std::vector
 #include <gtest/gtest.h> // TEST, ASSERT_EQ, ASSERT_TRUE, testing::InitGoogleTest, RUN_ALL_TE  STS
 #include <valarray> // std::valarray, std::abs
 
 #include "isce/unwrap/phass/Phass.h" // isce::unwrap::phass::Phass
+#include "isce/unwrap/phass/PixelQueue.h" // BucketQueue, PixelFifo
 #include "isce/io/Raster.h" // isce::io::Raster
 
 void runPhass();
@@ -89,6 +92,94 @@ TEST(Phass, CheckConnCompLabels)
 }
 
 
+TEST(Phass, PixelQueueOrder)
+{
+    // Packed indices past 2^32 must survive the queues unchanged
+    const pixel_index_t big = (pixel_index_t(1) << 33) + 12345;
+
+    // BucketQueue pops each bucket in the same order as a std::queue per bucket
+    // across segment boundaries, interleaved pushes/pops and segment reuse
+    const int nbuckets = 7;
+    BucketQueue buckets(nbuckets);
+    std::vector<std::queue<pixel_index_t>> ref(nbuckets + 3);
+    unsigned int state = 12345u;
+    auto next = [&state]() { state = state * 1103515245u + 12345u; return state >> 8; };
+    for (int iter = 0; iter < 20000; ++iter)
+    {
+        // Buckets beyond the initial count grow the queue
+        const int bucket = next() % (nbuckets + 3);
+        if (next() % 3 != 0)
+        {
+            const pixel_index_t index = big + next();
+            buckets.push(bucket, index);
+            ref[bucket].push(index);
+        }
+        else if (!ref[bucket].empty())
+        {
+            ASSERT_FALSE(buckets.empty(bucket));
+            ASSERT_EQ(buckets.front(bucket), ref[bucket].front());
+            buckets.pop(bucket);
+            ref[bucket].pop();
+        }
+        ASSERT_EQ(buckets.empty(bucket), ref[bucket].empty());
+    }
+    for (int bucket = 0; bucket < nbuckets + 3; ++bucket)
+    {
+        while (!ref[bucket].empty())
+        {
+            ASSERT_EQ(buckets.front(bucket), ref[bucket].front());
+            buckets.pop(bucket);
+            ref[bucket].pop();
+        }
+        ASSERT_TRUE(buckets.empty(bucket));
+    }
+    buckets.push(2, big);
+    buckets.clear(2);
+    ASSERT_TRUE(buckets.empty(2));
+
+    // PixelFifo pops in push order, grows past its capacity and keeps the
+    // pushed pixels until cleared
+    PixelFifo fifo(4);
+    std::queue<pixel_index_t> reffifo;
+    std::vector<pixel_index_t> pushed;
+    for (int iter = 0; iter < 1000; ++iter)
+    {
+        if (next() % 3 != 0 || reffifo.empty())
+        {
+            const pixel_index_t index = big + next();
+            fifo.push(index);
+            reffifo.push(index);
+            pushed.push_back(index);
+        }
+        else
+        {
+            ASSERT_EQ(fifo.pop(), reffifo.front());
+            reffifo.pop();
+        }
+        ASSERT_EQ(fifo.empty(), reffifo.empty());
+    }
+    ASSERT_EQ(fifo.pushed(), pushed.size());
+    for (size_t k = 0; k < pushed.size(); ++k)
+    {
+        ASSERT_EQ(fifo[k], pushed[k]);
+    }
+    fifo.clear();
+    ASSERT_TRUE(fifo.empty());
+    ASSERT_EQ(fifo.pushed(), 0u);
+
+    // after clear() the storage is reused from the start
+    for (size_t k = 0; k < 10; ++k)
+    {
+        fifo.push(big + k);
+    }
+    ASSERT_EQ(fifo.pushed(), 10u);
+    for (size_t k = 0; k < 10; ++k)
+    {
+        ASSERT_EQ(fifo.pop(), big + k);
+    }
+    ASSERT_TRUE(fifo.empty());
+}
+
 int main(int argc, char * argv[])
 {
     testing::InitGoogleTest(&argc, argv);